@@ -0,0 +1,284 @@
+/*
+ * bench.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs fixed workloads against the real code and prints the
+ * average M-cycles per call through EMU_printf, so changes
+ * can be compared on the target.
+ *
+ * TIMA counts at 65536Hz, once every 16 M-cycles in either
+ * CPU speed, and its overflow interrupt extends it to 24 bits.
+ * That interrupt costs a few cycles every 4096 M-cycles. The
+ * cost of reading the timer itself is measured first and
+ * subtracted from all results. Functions in the hot bank are
+ * called through their *_banked() wrappers, which adds the
+ * banked call trampoline to those.
+ */
+
+#include <gbdk/emu_debug.h>
+#include <string.h>
+#include <rand.h>
+
+#include "banks.h"
+#include "config.h"
+#include "maps.h"
+#include "obj.h"
+#include "sample.h"
+#include "sprites.h"
+#include "text.h"
+#include "bench.h"
+
+#define BENCH_REPS 16
+#define BENCH_SEED 42
+#define BENCH_TICK_CYCLES 16 // M-cycles per TIMA increment
+
+BANKREF(bench)
+
+static volatile uint16_t overflows = 0;
+static uint32_t overhead = 0;
+static uint32_t t_start = 0;
+static uint32_t t_sum = 0;
+
+static struct obj_state objs;
+
+static const enum SPRITES obj_types[] = {
+    SPR_LIGHT,
+    SPR_DARK,
+    SPR_SHOT,
+    SPR_SHOT_LIGHT,
+    SPR_SHOT_DARK,
+    SPR_EXPL,
+};
+
+#define OBJ_TYPE_COUNT (sizeof(obj_types) / sizeof(obj_types[0]))
+
+static void bench_tim(void) NONBANKED {
+    overflows++;
+}
+
+static uint32_t bench_now(void) NONBANKED {
+    uint16_t hi;
+    uint8_t lo;
+
+    CRITICAL {
+        hi = overflows;
+        lo = TIMA_REG;
+
+        // wrapped, but the interrupt did not run yet
+        if (IF_REG & TIM_IFLAG) {
+            hi++;
+            lo = TIMA_REG;
+        }
+    }
+
+    return ((uint32_t)hi << 8) | lo;
+}
+
+static void bench_begin(void) {
+    t_sum = 0;
+}
+
+static void bench_end(const char *name, uint8_t a, uint8_t b) {
+    uint32_t cycles = (t_sum * BENCH_TICK_CYCLES) / BENCH_REPS;
+    cycles = (cycles > overhead) ? (cycles - overhead) : 0;
+
+    // EMU_printf only knows 16 bit values
+    if (cycles > 0xFFFF) {
+        cycles = 0xFFFF;
+    }
+
+    EMU_printf("%s %hu %hu: %u\n", name, a, b, (uint16_t)cycles);
+}
+
+#define BENCH_CALL(x) do { \
+    t_start = bench_now(); \
+    x; \
+    t_sum += bench_now() - t_start; \
+} while (0)
+
+static void bench_overhead(void) {
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        BENCH_CALL(;);
+    }
+    overhead = (t_sum * BENCH_TICK_CYCLES) / BENCH_REPS;
+
+    EMU_printf("%s: %u\n", __func__, (uint16_t)overhead);
+}
+
+static void bench_spr_draw(void) {
+    for (uint8_t s = 0; s < SPRITE_COUNT; s++) {
+        for (uint8_t f = FLIP_NONE; f <= FLIP_XY; f++) {
+            bench_begin();
+            for (uint8_t i = 0; i < BENCH_REPS; i++) {
+                uint8_t hiwater = 0;
+                BENCH_CALL(spr_draw(s, f, 0, 0, 0, &hiwater));
+            }
+            bench_end("spr_draw", s, f);
+        }
+    }
+}
+
+// up to n objects of all types, spread over the field
+static uint8_t bench_obj_fill(uint8_t n) {
+    memset(&obj_state, 0, sizeof(struct obj_state));
+
+    uint8_t i = 0;
+    uint8_t full = 0;
+    while ((obj_state.live_cnt < n) && (full < OBJ_TYPE_COUNT)) {
+        int16_t x = (int16_t)((i * 37) & 0xFF) - 128;
+        int16_t y = (int16_t)((i * 53) & 0xFF) - 128;
+        int16_t spd = (int16_t)(i & 3) - 1;
+
+        if (obj_add_banked(obj_types[i % OBJ_TYPE_COUNT], x, y, spd, -spd) == OBJ_ADDED) {
+            full = 0;
+        } else {
+            full++;
+        }
+        i++;
+    }
+
+    return obj_state.live_cnt;
+}
+
+static void bench_obj_do(void) {
+    for (uint8_t n = 1; n <= MAX_OBJ; n++) {
+        uint8_t cnt = bench_obj_fill(n);
+        if (cnt < n) {
+            // all types are full for this tier
+            break;
+        }
+        objs = obj_state;
+
+        bench_begin();
+        for (uint8_t i = 0; i < BENCH_REPS; i++) {
+            // objects move and collide, so start from the same state
+            obj_state = objs;
+            initarand(BENCH_SEED);
+
+            int16_t spd_x = 0;
+            int16_t spd_y = 0;
+            struct bcd score = BCD(0);
+            uint8_t hiwater = 0;
+            BENCH_CALL(obj_do_banked(&spd_x, &spd_y, &score, &hiwater, 0));
+        }
+        bench_end("obj_do", cnt, 0);
+    }
+
+    memset(&obj_state, 0, sizeof(struct obj_state));
+}
+
+static void bench_text(void) {
+    static const uint16_t values[] = { 0, 7, 42, 1337, 65535 };
+    for (uint8_t v = 0; v < (sizeof(values) / sizeof(values[0])); v++) {
+        bench_begin();
+        for (uint8_t i = 0; i < BENCH_REPS; i++) {
+            BENCH_CALL(number(values[v], 0, 0, 0));
+        }
+        bench_end("number", v, 0);
+    }
+
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        BENCH_CALL(str("benchmark", 0, 0, 0));
+    }
+    bench_end("str", 0, 0);
+
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        BENCH_CALL(str_ascii("Benchmark 123", 0, 0, 0));
+    }
+    bench_end("str_ascii", 0, 0);
+}
+
+static void bench_map_fill(void) {
+    for (uint8_t bkg = 0; bkg <= 1; bkg++) {
+        bench_begin();
+        for (uint8_t i = 0; i < BENCH_REPS; i++) {
+            BENCH_CALL(map_fill(MAP_TITLE, bkg));
+        }
+        bench_end("map_fill", MAP_TITLE, bkg);
+    }
+}
+
+static void bench_crc(void) {
+    // calc_crc() is internal, this runs it over config and scores
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        BENCH_CALL(conf_write_crc());
+    }
+    bench_end("conf_write_crc", 0, 0);
+}
+
+static void bench_sample_isr(void) {
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        BENCH_CALL(sample_isr());
+    }
+    bench_end("sample_isr idle", 0, 0);
+
+    bench_begin();
+    for (uint8_t i = 0; i < BENCH_REPS; i++) {
+        if (!sample_running_banked()) {
+            sample_play_banked(SFX_EXPL_SHIP);
+        }
+        BENCH_CALL(sample_isr());
+    }
+    bench_end("sample_isr load", 0, 0);
+
+    EMU_printf("%s: expected %u\n", __func__, SAMPLE_ISR_CYCLES);
+}
+
+void bench(void) BANKED {
+    // VRAM is always accessible, so text and map writes do not wait
+    DISPLAY_OFF;
+
+    spr_init();
+    obj_set_tier(OBJ_TIER_GBC);
+    conf_get()->debug_flags = 0;
+
+    CRITICAL {
+        overflows = 0;
+        add_TIM(bench_tim);
+        TMA_REG = 0;
+        TIMA_REG = 0;
+        TAC_REG = TACF_65KHZ | TACF_START;
+
+        set_interrupts(TIM_IFLAG);
+    }
+
+    EMU_printf("%s: %s speed, %hu reps\n", __func__,
+               (_cpu == CGB_TYPE) ? "double" : "normal", BENCH_REPS);
+
+    bench_overhead();
+    bench_spr_draw();
+    bench_obj_do();
+    bench_text();
+    bench_map_fill();
+    bench_crc();
+    bench_sample_isr();
+
+    EMU_printf("%s: done\n", __func__);
+
+    set_interrupts(TIM_IFLAG | VBL_IFLAG);
+    DISPLAY_ON;
+    while (1) {
+        vsync();
+    }
+}
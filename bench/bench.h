@@ -0,0 +1,34 @@
+/*
+ * bench.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <gbdk/platform.h>
+
+/*
+ * Entry point of the benchmark ROM, see `make bench`.
+ * main() hands over right after conf_init(), the
+ * results go to the emulator debug output.
+ */
+void bench(void) BANKED;
+
+BANKREF_EXTERN(bench)
+
+#endif // __BENCH_H__
@@ -0,0 +1,44 @@
+//AUTOGENERATED FILE FROM cvtsong
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+#include "music_game.h"
+BANKREF(music_game)
+static const struct snd_instr music_game_instr[] = {
+	{ .length = 0x96, .env = 0x00, .poly = 0x00 }, // lead
+	{ .length = 0x2F, .env = 0x00, .poly = 0x11 }, // kick
+	{ .length = 0x10, .env = 0x02, .poly = 0x46 }, // snare
+};
+static const uint8_t music_game_pat0[] = {
+	0xF0,0x11,0x15,0x76,0x34,0x00,0x02,0x20,0x00,0x11,0x15,0x76,0x34,0x00,0x02,0x20,
+	0x00,0xFF,
+};
+static const uint8_t music_game_pat1[] = {
+	0x0D,0x0D,0x1E,0x10,0xD0,0xD1,0xE1,0x0D,0x0D,0x1E,0x10,0xD0,0xD1,0xE1,0xFF,
+};
+static const uint8_t music_game_pat2[] = {
+	0xEF,0xED,0xFF,
+};
+static const uint8_t * const music_game_patterns[] = {
+	music_game_pat0,music_game_pat1,music_game_pat2,
+};
+static const uint16_t music_game_notes1[] = {
+	1602,1297,1339,1102,1155,1379,1417,1732,
+};
+static const uint8_t music_game_order1[] = {
+	0,0,0,0,0,0,0,0,0,0,255,
+};
+static const uint16_t music_game_notes4[] = {
+	2,1,
+};
+static const uint8_t music_game_order4[] = {
+	1,1,1,1,2,2,1,1,1,1,255,
+};
+const struct song music_game = {
+	.order = { music_game_order1, NULL, music_game_order4 },
+	.notes = { music_game_notes1, NULL, music_game_notes4 },
+	.patterns = music_game_patterns,
+	.instr = music_game_instr,
+	.step = 160,
+	.loop = { 0, SND_NO_LOOP, 0 },
+};
@@ -0,0 +1,12 @@
+//AUTOGENERATED FILE FROM cvtsong
+#ifndef SONG_MUSIC_GAME_H
+#define SONG_MUSIC_GAME_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+
+#define music_game_SIZE 93
+extern const struct song music_game;
+
+BANKREF_EXTERN(music_game)
+#endif
@@ -0,0 +1,89 @@
+//AUTOGENERATED FILE FROM cvtsong
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+#include "music_menu.h"
+BANKREF(music_menu)
+static const struct snd_instr music_menu_instr[] = {
+	{ .length = 0x99, .env = 0x00, .poly = 0x00 }, // lead
+	{ .length = 0x2F, .env = 0x00, .poly = 0x11 }, // kick
+	{ .length = 0x10, .env = 0x02, .poly = 0x46 }, // snare
+};
+static const uint8_t music_menu_pat0[] = {
+	0xF0,0x44,0x66,0x99,0x00,0x00,0xE3,0x00,0x00,0x0E,0x48,0x88,0x8C,0xCF,0xF0,
+};
+static const uint8_t music_menu_pat1[] = {
+	0xF0,0x44,0x22,0xAA,0x77,0x17,0x13,0x11,0x10,0x00,0x55,0x35,0x33,0x11,0x22,0x33,
+	0x52,0xFF,
+};
+static const uint8_t music_menu_pat2[] = {
+	0xF0,0x44,0x66,0xAA,0x77,0x17,0x13,0x11,0x10,0x00,0x55,0x35,0x33,0x11,0x22,0x33,
+	0x52,0xFF,
+};
+static const uint8_t music_menu_pat3[] = {
+	0xF0,0x44,0x66,0x99,0x00,0x00,0xE3,0x00,0x02,0x11,0x2B,0xB2,0x38,0x8E,0x02,0x2F,
+	0xF0,
+};
+static const uint8_t music_menu_pat4[] = {
+	0xF0,0x44,0x66,0x99,0x00,0x00,0xE3,0x00,0x02,0x11,0x2B,0xB2,0x38,0x25,0x52,0x2F,
+	0xF0,
+};
+static const uint8_t music_menu_pat5[] = {
+	0xF0,0x44,0x44,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xFF,
+};
+static const uint8_t music_menu_pat6[] = {
+	0xF0,0xE6,0xFF,
+};
+static const uint8_t music_menu_pat7[] = {
+	0xF0,0xEF,0xED,0xFF,
+};
+static const uint8_t music_menu_pat8[] = {
+	0xF0,0xE0,0x44,0x33,0x00,0x00,0xEE,0x11,0x11,0x2D,0xFF,
+};
+static const uint8_t music_menu_pat9[] = {
+	0xF0,0xE2,0x33,0x00,0x00,0xEE,0x11,0x11,0x2D,0xFF,
+};
+static const uint8_t music_menu_pat10[] = {
+	0xF0,0xEF,0xE8,0x65,0x52,0x2F,0xF0,
+};
+static const uint8_t music_menu_pat11[] = {
+	0xF0,0xEF,0xEB,0x22,0xFF,
+};
+static const uint8_t music_menu_pat12[] = {
+	0xE0,0x1D,0x0E,0x11,0xE1,0x0E,0x31,0xD0,0xE1,0x1E,0x10,0xE1,0xFF,
+};
+static const uint8_t music_menu_pat13[] = {
+	0xEF,0xED,0xFF,
+};
+static const uint8_t music_menu_pat14[] = {
+	0xE6,0xFF,
+};
+static const uint8_t * const music_menu_patterns[] = {
+	music_menu_pat0,music_menu_pat1,music_menu_pat2,music_menu_pat3,music_menu_pat4,music_menu_pat5,music_menu_pat6,music_menu_pat7,music_menu_pat8,music_menu_pat9,music_menu_pat10,music_menu_pat11,music_menu_pat12,music_menu_pat13,music_menu_pat14,
+};
+static const uint16_t music_menu_notes1[] = {
+	1379,1936,1881,1923,1714,1907,1602,1943,1486,1297,1964,1930,1732,
+};
+static const uint8_t music_menu_order1[] = {
+	0,0,1,2,1,2,3,4,2,2,3,4,5,6,255,
+};
+static const uint16_t music_menu_notes2[] = {
+	1379,1486,1732,1297,1602,1907,1881,
+};
+static const uint8_t music_menu_order2[] = {
+	7,7,8,9,8,9,10,11,9,9,10,11,7,6,255,
+};
+static const uint16_t music_menu_notes4[] = {
+	1,2,
+};
+static const uint8_t music_menu_order4[] = {
+	12,12,12,12,12,12,12,12,12,12,12,12,13,14,255,
+};
+const struct song music_menu = {
+	.order = { music_menu_order1, music_menu_order2, music_menu_order4 },
+	.notes = { music_menu_notes1, music_menu_notes2, music_menu_notes4 },
+	.patterns = music_menu_patterns,
+	.instr = music_menu_instr,
+	.step = 150,
+	.loop = { 0, 0, 0 },
+};
@@ -0,0 +1,12 @@
+//AUTOGENERATED FILE FROM cvtsong
+#ifndef SONG_MUSIC_MENU_H
+#define SONG_MUSIC_MENU_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+
+#define music_menu_SIZE 284
+extern const struct song music_menu;
+
+BANKREF_EXTERN(music_menu)
+#endif
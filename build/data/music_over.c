@@ -0,0 +1,85 @@
+//AUTOGENERATED FILE FROM cvtsong
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+#include "music_over.h"
+BANKREF(music_over)
+static const struct snd_instr music_over_instr[] = {
+	{ .length = 0xA0, .env = 0x00, .poly = 0x00 }, // lead
+	{ .length = 0x2F, .env = 0x00, .poly = 0x11 }, // kick
+	{ .length = 0x10, .env = 0x02, .poly = 0x46 }, // snare
+};
+static const uint8_t music_over_pat0[] = {
+	0xF0,0x12,0x14,0x11,0x12,0x14,0x10,0x20,0x14,0xFF,
+};
+static const uint8_t music_over_pat1[] = {
+	0xF0,0x32,0x34,0x33,0x32,0x34,0x30,0x20,0x34,0xFF,
+};
+static const uint8_t music_over_pat2[] = {
+	0xF0,0x12,0x19,0x11,0x12,0x19,0x10,0x20,0x19,0xFF,
+};
+static const uint8_t music_over_pat3[] = {
+	0xF0,0x07,0x05,0x00,0x07,0x05,0x02,0x72,0x05,0xFF,
+};
+static const uint8_t music_over_pat4[] = {
+	0xF0,0x08,0x06,0x00,0x08,0x06,0x02,0x82,0x06,0xFF,
+};
+static const uint8_t music_over_pat5[] = {
+	0xF0,0x0A,0x06,0x00,0x08,0x06,0x02,0x82,0x06,0xFF,
+};
+static const uint8_t music_over_pat6[] = {
+	0xF0,0xEE,0xFF,
+};
+static const uint8_t music_over_pat7[] = {
+	0xF0,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,0xFF,
+};
+static const uint8_t music_over_pat8[] = {
+	0xF0,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0xFF,
+};
+static const uint8_t music_over_pat9[] = {
+	0xF0,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xFF,
+};
+static const uint8_t music_over_pat10[] = {
+	0xF0,0x33,0x33,0x33,0x33,0xE6,0xFF,
+};
+static const uint8_t music_over_pat11[] = {
+	0xF0,0x44,0x44,0x44,0x44,0xE6,0xFF,
+};
+static const uint8_t music_over_pat12[] = {
+	0x0E,0x30,0xD1,0xE1,0x0E,0x1F,0xF0,
+};
+static const uint8_t music_over_pat13[] = {
+	0xEE,0xFF,
+};
+static const uint8_t * const music_over_patterns[] = {
+	music_over_pat0,music_over_pat1,music_over_pat2,music_over_pat3,music_over_pat4,music_over_pat5,music_over_pat6,music_over_pat7,music_over_pat8,music_over_pat9,music_over_pat10,music_over_pat11,music_over_pat12,music_over_pat13,
+};
+static const uint16_t music_over_notes1[] = {
+	1978,1969,1985,1974,1954,1959,1964,1988,1992,1949,1995,
+};
+static const uint8_t music_over_order1[] = {
+	0,1,0,2,0,1,3,3,4,4,0,1,0,2,0,1,
+	3,3,4,5,6,255,
+};
+static const uint16_t music_over_notes2[] = {
+	1732,1750,1650,1812,1825,
+};
+static const uint8_t music_over_order2[] = {
+	7,8,7,9,7,8,10,6,11,6,7,8,7,9,7,8,
+	10,6,11,6,6,255,
+};
+static const uint16_t music_over_notes4[] = {
+	1,2,
+};
+static const uint8_t music_over_order4[] = {
+	12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+	12,12,12,12,13,255,
+};
+const struct song music_over = {
+	.order = { music_over_order1, music_over_order2, music_over_order4 },
+	.notes = { music_over_notes1, music_over_notes2, music_over_notes4 },
+	.patterns = music_over_patterns,
+	.instr = music_over_instr,
+	.step = 120,
+	.loop = { SND_NO_LOOP, SND_NO_LOOP, SND_NO_LOOP },
+};
@@ -0,0 +1,12 @@
+//AUTOGENERATED FILE FROM cvtsong
+#ifndef SONG_MUSIC_OVER_H
+#define SONG_MUSIC_OVER_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+
+#define music_over_SIZE 255
+extern const struct song music_over;
+
+BANKREF_EXTERN(music_over)
+#endif
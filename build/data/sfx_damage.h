@@ -0,0 +1,11 @@
+//AUTOGENERATED FILE FROM cvtsample
+#ifndef WAVE_SOUND_sfx_damage_H
+#define WAVE_SOUND_sfx_damage_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define sfx_damage_SIZE 0xb10
+extern const uint8_t sfx_damage[];
+
+BANKREF_EXTERN(sfx_damage)
+#endif
@@ -0,0 +1,137 @@
+//AUTOGENERATED FILE FROM cvtsample
+#include <stdint.h>
+#include <gbdk/platform.h>
+BANKREF(sfx_expl_orb)
+const uint8_t sfx_expl_orb[] = {
+0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x89,0x99,0x99,0x99,0x99,0x99,
+0x99,0x99,0x99,0x99,0x98,0x88,0x88,0x87,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x66,
+0x66,0x66,0x67,0x77,0x77,0x77,0x77,0x77,0x66,0x55,0x55,0x55,0x55,0x55,0x55,0x54,
+0x44,0x55,0x55,0x56,0x55,0x44,0x33,0x32,0x22,0x22,0x22,0x21,0x11,0x12,0x22,0x11,
+0x11,0x11,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x25,0xdf,0xef,0xee,0xdd,0xdc,0xbb,
+0xaa,0x98,0x76,0x66,0x77,0x77,0x76,0x77,0x88,0x88,0x87,0x76,0x55,0x56,0x66,0x77,
+0x89,0xab,0xcd,0xdd,0xdd,0xcc,0xcc,0xcc,0xcb,0xa9,0x99,0xab,0xcb,0xbb,0xbb,0xcd,
+0xdc,0xcc,0xcb,0xbc,0xdd,0xee,0xff,0xff,0xff,0xfe,0xdb,0xa8,0x87,0x54,0x22,0x11,
+0x12,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x24,0x45,0x67,0x77,0x65,0x33,0x32,0x22,
+0x11,0x10,0x11,0x33,0x27,0xff,0xee,0xee,0xdd,0xcb,0xaa,0x98,0x88,0x89,0x98,0x77,
+0x88,0x88,0xaa,0xa8,0x65,0x32,0x12,0x22,0x22,0x22,0x33,0x33,0x32,0x11,0x16,0xff,
+0xee,0xee,0xee,0xdd,0xdd,0xed,0xbb,0xaa,0x87,0x68,0x99,0x63,0x10,0x1,0x11,0x3,
+0xdd,0xa7,0x43,0x11,0x14,0xbf,0xed,0xca,0x99,0xaa,0xbb,0xba,0x98,0x76,0x67,0x76,
+0x53,0x22,0x22,0x11,0x1,0x22,0x22,0x22,0x10,0x13,0xbf,0xbb,0xbb,0xcc,0xdc,0xb9,
+0x75,0x32,0x22,0x22,0x33,0x32,0x21,0x11,0x12,0x22,0x22,0x21,0x11,0x11,0x29,0xfe,
+0xe9,0x32,0x38,0xea,0x41,0x9e,0xba,0xa9,0x76,0x66,0x89,0xaa,0xbc,0xbb,0xba,0x99,
+0x87,0x65,0x54,0x21,0x13,0xcf,0xef,0xed,0xcc,0xcd,0xdd,0xde,0xdd,0xcd,0xde,0x90,
+0x12,0x23,0x56,0x66,0x54,0x55,0x56,0x77,0x65,0x56,0x56,0x65,0x55,0x42,0x21,0x11,
+0x11,0x11,0x11,0x11,0x12,0x22,0x11,0x12,0x32,0x23,0x57,0x8b,0xcc,0xde,0xee,0xdd,
+0xcc,0xcb,0xa8,0x74,0x21,0x11,0x22,0x9f,0xa8,0x66,0x55,0x54,0x32,0x21,0x11,0x11,
+0x11,0x12,0x22,0x22,0x35,0x76,0x54,0x33,0x21,0x11,0x11,0x11,0x19,0xfd,0xed,0xdd,
+0xdd,0xcc,0xca,0xaa,0x97,0x52,0x12,0xbe,0xba,0x88,0x76,0x43,0x21,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x5e,0xee,0xed,0xde,0xed,0x50,0x21,0x23,0x11,0x33,0x33,0x32,
+0x11,0x12,0xbf,0xdc,0xa9,0x78,0x9a,0xcd,0xee,0xec,0x60,0x21,0x13,0x69,0xce,0xea,
+0x12,0x34,0x67,0x88,0x9a,0xcd,0xe6,0x2,0x35,0x56,0x66,0x66,0x56,0x7a,0xbc,0xed,
+0x95,0x42,0x27,0xee,0xdd,0xee,0xee,0xed,0x71,0x23,0x32,0x22,0x11,0x12,0x45,0x69,
+0xab,0xcd,0xdc,0xbb,0xac,0xde,0xee,0xed,0xcc,0xdc,0xdd,0xdd,0xeb,0x23,0x44,0x43,
+0x58,0xaa,0xba,0xba,0xcc,0xb9,0x86,0x65,0x44,0x54,0x33,0x21,0x3c,0xeb,0xba,0x99,
+0x87,0x65,0x55,0x66,0x65,0x42,0x11,0x14,0xdd,0xcd,0xa8,0x76,0x66,0x56,0x88,0x87,
+0x67,0x66,0x78,0x88,0x75,0x43,0x22,0x21,0x3b,0xed,0xcb,0xb9,0x86,0x53,0x34,0x57,
+0x77,0x77,0x54,0x44,0x31,0x2a,0xfb,0x97,0x65,0x54,0x21,0x11,0x5e,0xed,0xd3,0x13,
+0x22,0x11,0x14,0xbe,0xdc,0x61,0x12,0x22,0x11,0x11,0x11,0x11,0x11,0x33,0x12,0x22,
+0x22,0x23,0x44,0x43,0x32,0x23,0x33,0x35,0x67,0x75,0x44,0x33,0x33,0x11,0x26,0x43,
+0x39,0xfd,0xed,0xdd,0xdd,0xee,0xee,0xee,0xee,0xee,0xee,0xdd,0xcd,0xcc,0xde,0xdd,
+0xdc,0xcc,0xdd,0xde,0xee,0xed,0xcb,0xba,0x98,0x64,0x32,0x14,0xad,0xc9,0x9b,0xec,
+0x86,0x42,0x11,0x11,0x11,0x11,0x5d,0xed,0xdd,0xee,0xee,0xe9,0x52,0x12,0x34,0x33,
+0x44,0x33,0x31,0x14,0xbf,0xdd,0xba,0x86,0x54,0x22,0x11,0x11,0x11,0x22,0x33,0x45,
+0x78,0xaa,0xac,0xde,0xda,0x43,0x13,0x56,0x54,0x32,0x22,0x44,0x65,0x42,0x21,0x8f,
+0xdd,0xcc,0xbc,0xcb,0xaa,0xaa,0x9a,0x9a,0xbb,0xa8,0x54,0x44,0x67,0x89,0xbb,0xbb,
+0xbc,0xbc,0xcd,0xdd,0xee,0xc2,0x11,0x23,0x8f,0xde,0xcd,0xcb,0x98,0x77,0x78,0x99,
+0xaa,0xbd,0xed,0xcb,0xa9,0xab,0xdd,0xe7,0x1,0x11,0x6e,0xdb,0xb9,0x63,0x35,0xce,
+0xee,0xde,0xde,0xee,0xee,0xeb,0x30,0x11,0x22,0x22,0x21,0x11,0x24,0x8b,0xde,0xc4,
+0x1,0x12,0x24,0x67,0x78,0x89,0xbd,0xee,0xee,0xeb,0x62,0x24,0x55,0x55,0x31,0x4d,
+0xdb,0xb9,0x97,0x53,0x32,0x11,0x35,0xce,0xed,0x98,0xae,0xdc,0xcb,0xbc,0xcb,0xba,
+0x9a,0xaa,0x99,0xaa,0x98,0x86,0x56,0x54,0x34,0x56,0x65,0x66,0x67,0x77,0x77,0x9a,
+0xdc,0x23,0x55,0x88,0x77,0x87,0x66,0x77,0x87,0x78,0x88,0x76,0x8a,0xbc,0xdd,0xde,
+0xee,0xec,0x41,0x46,0xdc,0x75,0x8d,0xdb,0x86,0x43,0x34,0x66,0x44,0x43,0x34,0x55,
+0x55,0x65,0x53,0x22,0x22,0x7d,0xca,0x99,0xaa,0xba,0xa8,0x63,0x32,0x22,0x33,0x35,
+0x78,0x9a,0xcd,0xee,0xdc,0xbb,0xab,0xdd,0xdc,0xb9,0x86,0x65,0x66,0x78,0xab,0xbb,
+0xa8,0x89,0xa9,0x98,0x77,0x65,0x32,0x7e,0xa8,0x64,0x33,0x32,0x32,0x33,0x33,0x34,
+0x68,0x8d,0xed,0xee,0xed,0xed,0xd7,0x25,0x68,0xab,0xcc,0xcd,0xdd,0xee,0xed,0xdd,
+0xdd,0xdd,0xdc,0xba,0x76,0x43,0x34,0x44,0x4a,0xec,0xcc,0xdd,0xdd,0xcc,0xcc,0xcc,
+0xcc,0xcc,0xcc,0xbb,0xa9,0x89,0xaa,0xa9,0x88,0x99,0x9a,0xab,0xbd,0xde,0x92,0x57,
+0xab,0xdd,0xdc,0xcc,0xb9,0x75,0x54,0x44,0x7e,0xed,0xdd,0xee,0xec,0x63,0x54,0x44,
+0x55,0x55,0x54,0x54,0x44,0x45,0x55,0x55,0x56,0x66,0x66,0x67,0x78,0x9a,0xbb,0xbb,
+0xcc,0xba,0x97,0x66,0x65,0x44,0x44,0x43,0x33,0x33,0x39,0xba,0xa9,0x97,0x76,0x77,
+0x77,0x78,0x99,0xbd,0xdd,0xcc,0xcb,0xbb,0xcc,0xba,0xa9,0x87,0x54,0x23,0xaa,0x99,
+0x99,0x88,0x76,0x65,0x55,0x43,0x22,0x22,0x38,0xa9,0x97,0x54,0x32,0x25,0xa8,0x76,
+0x43,0x22,0x22,0x4a,0xac,0xcb,0xba,0xa9,0x98,0x76,0x78,0xaa,0xaa,0xaa,0xa8,0x63,
+0x23,0x46,0x67,0x77,0x77,0x77,0x66,0x54,0x32,0x23,0x56,0x43,0x45,0x66,0x67,0x79,
+0xdd,0xcb,0xaa,0xab,0xbb,0xbb,0xa6,0x44,0x33,0x33,0x22,0x22,0x22,0x23,0x69,0x89,
+0x99,0x98,0x76,0x66,0x55,0x44,0x44,0x55,0x67,0x89,0x89,0xbc,0xcc,0xbb,0xbc,0xcc,
+0xcc,0xdd,0xdd,0xc9,0x78,0x88,0x89,0x99,0x99,0x99,0x99,0x99,0x88,0x77,0x65,0x44,
+0x44,0x44,0x44,0x32,0x22,0x33,0x32,0x22,0x23,0x33,0x34,0x44,0x55,0x66,0x66,0x67,
+0x66,0x66,0x67,0x77,0x88,0xac,0xbb,0xa9,0x87,0x65,0x54,0x44,0x57,0x89,0xcd,0xcc,
+0xba,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0x98,0x88,0x77,0x66,0x65,0x55,0x55,0x55,
+0x67,0x78,0xac,0xb9,0x88,0x87,0x78,0xac,0xcc,0xa9,0xab,0xcc,0xcc,0xcc,0xcc,0xcc,
+0xbb,0xa9,0x88,0x87,0x77,0x66,0x66,0x66,0x64,0x23,0x45,0x77,0x66,0x66,0x43,0x44,
+0x55,0x55,0x55,0x55,0x54,0x44,0x33,0x33,0x23,0x33,0x33,0x44,0x44,0x54,0x44,0x55,
+0x56,0x67,0x76,0x55,0x66,0x78,0x88,0x88,0x9a,0xbc,0xcc,0xdd,0xcc,0xbb,0xaa,0xcc,
+0xdc,0xcc,0xcc,0xcc,0xcb,0xba,0xaa,0xaa,0x99,0xa9,0x99,0x87,0x65,0x55,0x55,0x67,
+0x8a,0xbc,0xdd,0xcc,0xcc,0xcb,0x97,0x78,0xab,0xaa,0xbc,0xcc,0xcc,0xdc,0xcc,0xbb,
+0xbc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xa9,0x99,0xaa,0x98,0x79,0xbc,0xcc,0xcb,0xaa,
+0x99,0x87,0x65,0x43,0x33,0x33,0x46,0x9c,0xcc,0xcc,0xbb,0xaa,0x99,0x88,0x77,0x65,
+0x44,0x33,0x33,0x33,0x34,0x69,0xcc,0xcc,0xbb,0xbb,0xbb,0x97,0x54,0x44,0x56,0x67,
+0x9b,0xcc,0xcc,0xcc,0xcb,0xbb,0xaa,0xaa,0x99,0x87,0x77,0x78,0x88,0x88,0x77,0x77,
+0x66,0x66,0x77,0x87,0x76,0x77,0x78,0x88,0x88,0x9a,0xa9,0x99,0x99,0x99,0x88,0x99,
+0x9a,0xaa,0xab,0xbb,0xbb,0xcc,0xcc,0xcc,0xcc,0xb9,0x86,0x43,0x33,0x33,0x33,0x47,
+0xbc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xba,0xaa,0xaa,0xbb,0xbc,0xcc,0xcc,0xcc,0xcb,
+0xaa,0x97,0x44,0x56,0x9b,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xaa,0xaa,0xaa,
+0xa9,0x98,0x77,0x78,0x9a,0xaa,0xa9,0x99,0x9a,0xab,0xbc,0xcc,0xcb,0xa8,0x66,0x54,
+0x44,0x56,0x9b,0xaa,0xab,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xaa,0xaa,0xaa,0xaa,0x98,
+0x88,0x88,0x89,0xaa,0xbb,0xbb,0xba,0xa9,0x98,0x65,0x44,0x43,0x33,0x33,0x45,0xac,
+0xcc,0xcb,0xbb,0xbb,0xaa,0xaa,0xa9,0x98,0x77,0x65,0x44,0x44,0x44,0x33,0x33,0x33,
+0x33,0x33,0x33,0x33,0x33,0x45,0x88,0x9a,0xbc,0xcc,0xcb,0xaa,0x98,0x76,0x65,0x43,
+0x33,0x33,0x33,0x34,0x34,0x68,0x9b,0xcc,0xcc,0xba,0xa9,0x99,0x98,0x76,0x65,0x55,
+0x43,0x33,0x33,0x33,0x45,0x8b,0xcc,0xcc,0xba,0xa8,0x76,0x55,0x56,0x66,0x66,0x66,
+0x77,0x66,0x67,0x76,0x66,0x66,0x55,0x44,0x44,0x33,0x33,0x47,0x9b,0xcc,0xcc,0xcb,
+0xbb,0xaa,0x99,0x88,0x77,0x66,0x65,0x55,0x54,0x44,0x43,0x33,0x33,0x44,0x56,0x78,
+0x9b,0xba,0x98,0x98,0xab,0xcc,0xcb,0xba,0xa9,0x99,0x9a,0xa9,0x99,0x99,0xaa,0xab,
+0xbb,0xba,0xab,0xba,0xa9,0x98,0x88,0x77,0x76,0x54,0x44,0x44,0x44,0x33,0x34,0x57,
+0xaa,0x98,0x99,0x77,0x8a,0xbb,0xbc,0xcc,0xcb,0x97,0x65,0x44,0x45,0x69,0xbc,0xcc,
+0xcc,0xcc,0xcb,0xa9,0x54,0x34,0x58,0xcc,0xba,0xaa,0xaa,0xaa,0xbb,0xbc,0xbb,0xba,
+0x99,0x87,0x77,0x77,0x77,0x77,0x77,0x66,0x55,0x54,0x44,0x33,0x33,0x45,0x79,0xab,
+0xbc,0xcc,0xcc,0xcc,0xcc,0xbb,0xcc,0xcc,0xcc,0xcc,0xcc,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xba,0xa9,0x99,0x98,0x88,0x88,0x77,0x77,0x77,0x66,0x77,0x77,0x77,0x77,0x77,0x65,
+0x55,0x55,0x44,0x33,0x33,0x35,0x8a,0xbc,0xcc,0xcc,0xbb,0xaa,0x98,0x77,0x77,0x76,
+0x54,0x33,0x45,0x7a,0xbb,0xbb,0xbc,0xcc,0xbb,0xbb,0xbb,0xaa,0xab,0xbb,0xaa,0xaa,
+0x99,0x87,0x77,0x77,0x76,0x65,0x54,0x44,0x33,0x57,0xab,0xbc,0xcc,0xcc,0xcc,0xbb,
+0xbb,0xbc,0xcc,0xcc,0xbb,0xba,0x85,0x43,0x44,0x44,0x44,0x44,0x44,0x43,0x45,0x8b,
+0xcc,0xcb,0xbb,0xbb,0xbb,0xbb,0xba,0x99,0x87,0x66,0x55,0x66,0x55,0x55,0x56,0x66,
+0x77,0x88,0x99,0xaa,0xbb,0xaa,0xaa,0xaa,0xaa,0xa9,0x99,0xa9,0x99,0x98,0x99,0x88,
+0x77,0x66,0x65,0x55,0x44,0x43,0x44,0x44,0x44,0x34,0x44,0x44,0x44,0x44,0x44,0x34,
+0x45,0x7a,0xbb,0xbb,0xcb,0xbb,0xba,0xaa,0x99,0x98,0x88,0x76,0x54,0x44,0x7a,0xbb,
+0xbb,0xaa,0xaa,0xaa,0x99,0x98,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x88,
+0x88,0x88,0x88,0x87,0x66,0x66,0x55,0x54,0x44,0x44,0x44,0x44,0x44,0x45,0x56,0x89,
+0xab,0xbb,0xbb,0xbb,0xbb,0xbb,0xa9,0x87,0x65,0x44,0x44,0x44,0x44,0x56,0x79,0xab,
+0xbb,0xbb,0xbb,0xbb,0xbb,0xba,0xa9,0x99,0x88,0x87,0x76,0x55,0x55,0x44,0x44,0x45,
+0x7a,0xbb,0xbb,0xba,0xaa,0x98,0x87,0x78,0x99,0x99,0x98,0x88,0x77,0x65,0x54,0x44,
+0x44,0x44,0x45,0x68,0x9a,0xab,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xbb,0xbb,0xba,0xa9,0x88,0x76,0x54,0x44,0x47,0xab,0xbb,0xbb,0xaa,0x98,0x76,0x55,
+0x44,0x44,0x44,0x44,0x44,0x55,0x7a,0xbb,0xbb,0xbb,0xa9,0x99,0x88,0x77,0x66,0x66,
+0x54,0x44,0x44,0x44,0x56,0x8a,0xbb,0xbb,0xaa,0x98,0x76,0x65,0x44,0x45,0x57,0x9a,
+0xbb,0xbb,0xbb,0xbb,0xaa,0x99,0x87,0x76,0x66,0x66,0x55,0x55,0x44,0x44,0x44,0x54,
+0x44,0x44,0x44,0x44,0x55,0x67,0x8a,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xba,
+0xaa,0x99,0x88,0x88,0x88,0x87,0x77,0x66,0x55,0x54,0x44,0x44,0x44,0x55,0x78,0x9a,
+0xbb,0xbb,0xbb,0xbb,0xba,0xaa,0xaa,0xab,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xba,0xaa,0xaa,0x99,0x98,0x88,0x77,0x77,0x77,0x77,0x76,0x77,0x78,0x88,0x99,0x99,
+0x99,0x99,0x99,0xaa,0xaa,0xab,0xbb,0xbb,0xbb,0xbb,0xbb,0xba,0xaa,0xaa,0xaa,0x99,
+0x88,0x88,0x77,0x77,0x77,0x88,0x99,0x98,0x99,0x99,0x99,0x99,0x9a,0xaa,0xaa,0xaa,
+0xab,0xaa,0xaa,0xaa,0xaa,0xa9,0x99,0x99,0x99,0x99,0x99,0x9a,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0xa9,0x9a,0x99,0xaa,0xaa,0xaa,0xab,0xbb,
+0xba,0xaa,0xaa,0xbb,0xba,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0x86,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x67,0x89,0x99,0xaa,0xaa,0xaa,0xaa,0xaa,0x99,0x99,0x99,0x98,0x88,0x88,
+0x87,0x76,0x65,0x55,0x55,0x55,0x55,0x67,0x89,0xaa,0xaa,0xaa,0xa9,0x99,0x87,0x76,
+0x65,0x55,0x55,0x55,0x66,0x66,0x77,0x77,0x88,0x88,0x88,0x88,0x77,0x76,0x55,0x55,
+0x55,0x55,0x55,0x55,0x55,0x66,0x66,0x66,0x66,0x66,0x67,0x77,0x77,0x77,0x77,0x78,
+0x88,0x88,0x88,0x99,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xa9,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x88,0x88,0x88,0x88,0x99,0x98,
+0x88,0x89,0x99,0x99,0xaa,0xaa,0x99,0x99,0x99,0x99,0x99,0x99,0x98,0x88,0x88,0x88,
+};
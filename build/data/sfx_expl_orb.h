@@ -0,0 +1,11 @@
+//AUTOGENERATED FILE FROM cvtsample
+#ifndef WAVE_SOUND_sfx_expl_orb_H
+#define WAVE_SOUND_sfx_expl_orb_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define sfx_expl_orb_SIZE 0x830
+extern const uint8_t sfx_expl_orb[];
+
+BANKREF_EXTERN(sfx_expl_orb)
+#endif
@@ -0,0 +1,206 @@
+//AUTOGENERATED FILE FROM cvtsample
+#include <stdint.h>
+#include <gbdk/platform.h>
+BANKREF(sfx_expl_ship)
+const uint8_t sfx_expl_ship[] = {
+0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x99,0x99,0x99,0x99,0x99,
+0x99,0x99,0x99,0x99,0x99,0x99,0x98,0x88,0x88,0x88,0x77,0x77,0x77,0x77,0x77,0x77,
+0x77,0x77,0x76,0x66,0x66,0x66,0x67,0x77,0x77,0x77,0x77,0x77,0x76,0x65,0x55,0x55,
+0x55,0x55,0x55,0x55,0x54,0x44,0x44,0x55,0x55,0x55,0x55,0x44,0x33,0x32,0x22,0x22,
+0x22,0x22,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
+0x0,0x2,0x4b,0xff,0xff,0xee,0xed,0xdc,0xcc,0xba,0xaa,0x87,0x66,0x66,0x77,0x67,
+0x76,0x67,0x78,0x88,0x88,0x77,0x66,0x55,0x55,0x66,0x67,0x78,0x9a,0xbc,0xdd,0xdd,
+0xdd,0xcc,0xcc,0xcc,0xcc,0xba,0xa9,0x99,0xab,0xcb,0xbb,0xbb,0xcd,0xdd,0xdd,0xdc,
+0xcb,0xcd,0xdd,0xee,0xff,0xff,0xff,0xff,0xfe,0xca,0x98,0x76,0x53,0x22,0x11,0x11,
+0x11,0x11,0x11,0x10,0x0,0x11,0x0,0x11,0x13,0x34,0x56,0x77,0x77,0x64,0x33,0x32,
+0x22,0x11,0x10,0x0,0x13,0x32,0x3a,0xff,0xff,0xfe,0xed,0xdc,0xba,0xa9,0x98,0x88,
+0x89,0x99,0x87,0x78,0x88,0x9a,0xba,0x96,0x64,0x32,0x11,0x22,0x22,0x22,0x22,0x33,
+0x33,0x22,0x11,0x5,0xef,0xff,0xff,0xfe,0xee,0xde,0xde,0xed,0xbb,0xba,0x98,0x77,
+0x89,0x86,0x31,0x0,0x0,0x11,0x1,0xbf,0xb9,0x64,0x21,0x0,0x17,0xef,0xed,0xcb,
+0x99,0xaa,0xbb,0xbc,0xa9,0x87,0x76,0x77,0x76,0x54,0x32,0x22,0x11,0x0,0x1,0x22,
+0x22,0x21,0x10,0x11,0x5e,0xeb,0xbb,0xbc,0xcd,0xdc,0xba,0x76,0x42,0x22,0x21,0x22,
+0x33,0x22,0x11,0x11,0x12,0x22,0x21,0x11,0x11,0x11,0x0,0x3c,0xfe,0xeb,0x42,0x24,
+0xbe,0xb5,0x16,0xed,0xba,0xa9,0x76,0x66,0x78,0x9a,0xab,0xcb,0xbb,0xba,0x99,0x87,
+0x75,0x45,0x42,0x10,0x2b,0xfe,0xfe,0xed,0xcc,0xcd,0xdd,0xdd,0xee,0xdd,0xde,0xee,
+0x50,0x11,0x22,0x45,0x66,0x65,0x45,0x55,0x56,0x77,0x55,0x55,0x55,0x65,0x55,0x54,
+0x32,0x11,0x11,0x10,0x11,0x1,0x0,0x1,0x12,0x21,0x11,0x12,0x22,0x22,0x46,0x79,
+0xcd,0xdd,0xee,0xee,0xdd,0xcc,0xcb,0xa9,0x86,0x31,0x1,0x12,0x15,0xed,0xa8,0x66,
+0x55,0x54,0x32,0x11,0x11,0x11,0x1,0x11,0x11,0x12,0x22,0x23,0x56,0x65,0x43,0x32,
+0x11,0x11,0x11,0x11,0x12,0xcf,0xde,0xee,0xee,0xdd,0xcc,0xcb,0xaa,0xa9,0x64,0x21,
+0x18,0xfc,0xb9,0x87,0x76,0x53,0x21,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x1a,
+0xfe,0xfe,0xed,0xee,0xec,0x30,0x10,0x23,0x20,0x22,0x22,0x32,0x21,0x11,0x12,0xcf,
+0xed,0xb9,0x88,0x89,0xac,0xde,0xee,0xec,0x51,0x11,0x12,0x47,0x9c,0xee,0xc3,0x12,
+0x35,0x67,0x88,0x8a,0xbd,0xee,0x60,0x23,0x45,0x56,0x66,0x66,0x55,0x68,0xab,0xde,
+0xea,0x65,0x32,0x17,0xee,0xed,0xee,0xee,0xee,0xe9,0x21,0x23,0x22,0x21,0x11,0x11,
+0x34,0x57,0x9a,0xbb,0xdd,0xdc,0xbb,0xac,0xde,0xee,0xee,0xdc,0xdd,0xdd,0xdd,0xde,
+0xee,0x51,0x44,0x43,0x34,0x79,0xab,0xbb,0xbb,0xcc,0xcb,0x97,0x66,0x54,0x44,0x43,
+0x33,0x11,0x2b,0xec,0xca,0xa9,0x98,0x76,0x65,0x55,0x66,0x65,0x43,0x21,0x11,0x4d,
+0xdd,0xdc,0xa8,0x76,0x66,0x55,0x78,0x87,0x76,0x76,0x66,0x78,0x88,0x76,0x43,0x22,
+0x21,0x13,0xbe,0xed,0xcc,0xa9,0x76,0x53,0x33,0x45,0x77,0x77,0x76,0x44,0x34,0x21,
+0x18,0xfd,0xb8,0x75,0x65,0x43,0x21,0x11,0x6e,0xee,0xf8,0x2,0x22,0x11,0x11,0x27,
+0xee,0xdc,0x71,0x11,0x12,0x11,0x11,0x11,0x11,0x11,0x11,0x33,0x11,0x12,0x22,0x22,
+0x34,0x44,0x33,0x32,0x22,0x33,0x34,0x56,0x77,0x54,0x43,0x33,0x32,0x11,0x15,0x53,
+0x23,0xbf,0xee,0xee,0xed,0xde,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xdd,0xdd,0xcd,
+0xee,0xdd,0xdd,0xdc,0xcd,0xdd,0xee,0xee,0xed,0xcc,0xba,0x98,0x76,0x43,0x21,0x27,
+0xcd,0xc9,0x9b,0xee,0xa7,0x53,0x21,0x11,0x11,0x11,0x11,0x5c,0xee,0xdd,0xee,0xee,
+0xee,0xb6,0x41,0x12,0x33,0x33,0x34,0x33,0x22,0x11,0x28,0xee,0xed,0xcb,0x97,0x54,
+0x32,0x11,0x11,0x11,0x11,0x12,0x33,0x35,0x78,0x9a,0xab,0xcd,0xee,0xd7,0x42,0x13,
+0x46,0x55,0x32,0x22,0x33,0x45,0x54,0x31,0x11,0x7f,0xee,0xdd,0xcc,0xcc,0xba,0xaa,
+0xa9,0xaa,0x9a,0xbb,0xb9,0x75,0x43,0x45,0x78,0x9a,0xbb,0xbb,0xbc,0xcc,0xcc,0xdd,
+0xde,0xee,0x70,0x11,0x23,0x8e,0xee,0xdd,0xdc,0xba,0x87,0x77,0x79,0x99,0xaa,0xbd,
+0xee,0xdc,0xca,0xaa,0xbc,0xde,0xe6,0x1,0x1,0x2a,0xec,0xbb,0xa7,0x42,0x36,0xde,
+0xee,0xee,0xee,0xee,0xee,0xee,0xd7,0x11,0x11,0x11,0x12,0x21,0x11,0x12,0x47,0xac,
+0xee,0xa2,0x11,0x12,0x23,0x56,0x77,0x78,0x9b,0xcd,0xee,0xee,0xec,0x83,0x12,0x45,
+0x55,0x54,0x20,0x7e,0xcb,0xba,0x98,0x75,0x32,0x21,0x12,0x38,0xee,0xed,0xa8,0x9d,
+0xed,0xcc,0xbb,0xcc,0xcb,0xba,0xaa,0xba,0xa9,0xaa,0xa9,0x88,0x65,0x65,0x43,0x34,
+0x56,0x65,0x55,0x66,0x77,0x76,0x78,0xab,0xfb,0x23,0x45,0x68,0x87,0x78,0x76,0x66,
+0x78,0x87,0x78,0x88,0x86,0x68,0xab,0xcd,0xdd,0xee,0xee,0xed,0x50,0x34,0x9e,0xb7,
+0x57,0xce,0xdb,0x86,0x43,0x34,0x56,0x54,0x33,0x33,0x34,0x44,0x55,0x55,0x43,0x21,
+0x11,0x28,0xed,0xb9,0x9a,0xab,0xbb,0xa9,0x64,0x21,0x11,0x12,0x22,0x35,0x78,0x9a,
+0xcd,0xee,0xed,0xdc,0xbb,0xcd,0xdd,0xcb,0xa9,0x76,0x54,0x55,0x56,0x89,0xab,0xbb,
+0xa9,0x9a,0xba,0xa9,0x77,0x76,0x42,0x6,0xeb,0x87,0x43,0x21,0x11,0x11,0x11,0x11,
+0x11,0x23,0x76,0xae,0xee,0xee,0xee,0xee,0xde,0x60,0x34,0x68,0xab,0xcc,0xcd,0xde,
+0xee,0xee,0xee,0xee,0xee,0xde,0xdd,0xb9,0x75,0x31,0x11,0x22,0x22,0x7e,0xed,0xdd,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xed,0xcb,0xaa,0xbc,0xdc,0xa9,0x78,
+0x88,0x89,0xaa,0xbc,0xde,0xd4,0x15,0x8b,0xcd,0xdd,0xcc,0xcc,0xa8,0x54,0x21,0x11,
+0x4,0xde,0xde,0xee,0xee,0xee,0x60,0x11,0x11,0x12,0x22,0x32,0x22,0x21,0x11,0x11,
+0x12,0x22,0x23,0x45,0x56,0x66,0x78,0x89,0xaa,0xab,0xba,0xab,0xcb,0xa9,0x64,0x43,
+0x32,0x11,0x11,0x11,0x11,0x11,0x10,0x7e,0xed,0xbb,0xb9,0x98,0x88,0x88,0x9a,0xbc,
+0xdd,0xde,0xed,0xdc,0xcc,0xcc,0xcd,0xdc,0xbb,0xba,0x97,0x53,0x11,0xbe,0xcd,0xcc,
+0xbc,0xb9,0x87,0x76,0x65,0x43,0x11,0x11,0x14,0xcf,0xed,0xb8,0x55,0x32,0x5,0xec,
+0xa8,0x64,0x21,0x11,0x12,0xbf,0xdd,0xba,0x99,0x88,0x87,0x76,0x45,0x79,0xbc,0xde,
+0xee,0xed,0xa6,0x21,0x11,0x11,0x22,0x33,0x45,0x55,0x54,0x43,0x21,0x11,0x37,0x86,
+0x21,0x11,0x11,0x11,0x24,0xbe,0xdd,0xcb,0xab,0xbd,0xde,0xee,0xc4,0x1,0x11,0x11,
+0x11,0x11,0x11,0x11,0x12,0x9e,0xee,0xee,0xed,0xcb,0xaa,0x99,0x76,0x66,0x66,0x77,
+0x8a,0xbc,0xdc,0xcc,0xcc,0xbb,0xbb,0xab,0xbb,0xbb,0xce,0xee,0xed,0x71,0x12,0x33,
+0x44,0x56,0x67,0x88,0xab,0xbc,0xdd,0xcc,0xbb,0x98,0x76,0x65,0x56,0x55,0x43,0x11,
+0x13,0x44,0x31,0x11,0x12,0x33,0x34,0x56,0x67,0x79,0x9a,0xbb,0xcd,0xcb,0xa9,0x76,
+0x43,0x21,0x13,0xbe,0xdd,0xcc,0xbc,0xba,0x88,0x66,0x54,0x22,0x14,0xde,0xdc,0xba,
+0x9a,0xab,0xcc,0xdd,0xdc,0xbb,0xba,0xba,0x99,0x87,0x77,0x66,0x67,0x78,0x88,0x99,
+0xaa,0xcc,0xdd,0xde,0xdb,0x51,0x21,0x11,0x22,0x8d,0xdd,0xee,0xdd,0xcc,0xcc,0xcb,
+0xbb,0xbc,0xdd,0xdd,0xdd,0xcb,0xba,0xbc,0xcc,0xdd,0xde,0xed,0xd8,0x22,0x56,0x8a,
+0xbc,0xdd,0xe9,0x22,0x23,0x33,0x32,0x22,0x22,0x22,0x22,0x22,0x32,0x22,0x22,0x34,
+0x45,0x56,0x78,0x89,0x98,0x99,0xab,0xcc,0xdd,0xda,0x42,0x22,0x35,0x66,0x67,0x89,
+0x9b,0xcd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xcc,0xcc,0xcc,0xcd,0xdd,0xcb,
+0xbc,0xc9,0x8c,0xdd,0xdd,0xdd,0xca,0x89,0xcd,0xdd,0xcb,0xbb,0xcc,0xdd,0xdd,0xcc,
+0xdd,0xdd,0xcb,0xaa,0xaa,0xaa,0xbb,0xbb,0xcd,0xdd,0xdd,0x95,0x44,0xad,0xdd,0xdd,
+0xdd,0xcc,0xcc,0xcb,0xa8,0x87,0x65,0x43,0x22,0x26,0xcd,0xdd,0xdd,0xcc,0xcb,0xba,
+0x99,0x87,0x54,0x32,0x22,0x27,0xdd,0xdc,0xba,0x87,0x66,0x66,0x66,0x67,0x77,0x77,
+0x77,0x76,0x54,0x32,0x22,0x4c,0xdc,0xcb,0x98,0x64,0x32,0x24,0xbd,0xcb,0xa9,0x76,
+0x43,0x22,0x22,0x38,0xed,0xdc,0xa9,0x98,0x87,0x88,0x77,0x76,0x54,0x32,0x24,0xbe,
+0xdd,0xcb,0xa8,0x65,0x43,0x22,0x24,0x7c,0xdd,0xdd,0xdc,0xcc,0xbb,0xaa,0xbc,0xcc,
+0xcc,0xcc,0xbb,0xbb,0xbc,0xcc,0xba,0x99,0x99,0x88,0x88,0x87,0x77,0x76,0x65,0x55,
+0x44,0x45,0x55,0x54,0x43,0x33,0x33,0x45,0x55,0x55,0x67,0x88,0x89,0x99,0x9a,0xbc,
+0xdd,0xdd,0xdd,0xdd,0xdd,0xdc,0x61,0x22,0x33,0x33,0x34,0x33,0x22,0x22,0x33,0x32,
+0x22,0x22,0x22,0x33,0x44,0x44,0x44,0x43,0x32,0x22,0x22,0x33,0x45,0x56,0x78,0x9a,
+0xbc,0xcb,0xbb,0xab,0xcd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdc,0xcd,0xcc,0xcd,0xdd,0xdd,
+0xdd,0xdc,0xdd,0xdc,0xcc,0xdd,0xc5,0x13,0x23,0x33,0x34,0x44,0x45,0x55,0x54,0x44,
+0x44,0x43,0x33,0x32,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x34,
+0x44,0x55,0x55,0x56,0x67,0x77,0x77,0x77,0x88,0x9a,0xa9,0x98,0x65,0x44,0x33,0x44,
+0x33,0x22,0x22,0x23,0x22,0x27,0xdd,0xdd,0xdc,0xcb,0xba,0xa9,0x99,0x98,0x76,0x54,
+0x33,0x22,0x22,0x23,0x33,0x45,0x65,0x42,0x22,0x22,0x22,0x22,0x23,0x48,0xdd,0xdc,
+0xcb,0xa9,0x88,0x76,0x54,0x32,0x22,0x38,0xdd,0xcb,0xba,0xaa,0xaa,0x99,0xaa,0xba,
+0xa8,0x87,0x65,0x55,0x54,0x44,0x45,0x55,0x56,0x66,0x66,0x65,0x44,0x32,0x22,0x4a,
+0xed,0xcc,0xcb,0xbb,0xbb,0xba,0xbb,0xbb,0xbb,0xba,0x99,0x76,0x66,0x78,0x89,0x98,
+0x88,0x77,0x76,0x55,0x54,0x33,0x22,0x22,0x22,0x23,0x7c,0xdd,0xdd,0xdd,0xdc,0xcb,
+0xbb,0xba,0x99,0x88,0x76,0x54,0x32,0x22,0x49,0xcd,0xdd,0xdd,0xdc,0xcb,0xaa,0x99,
+0x88,0x77,0x76,0x66,0x55,0x44,0x33,0x32,0x22,0x22,0x49,0xdd,0xdc,0xba,0x98,0x76,
+0x66,0x66,0x55,0x44,0x44,0x56,0x78,0x88,0x89,0x99,0x9a,0xaa,0x99,0x99,0x99,0x99,
+0x88,0x88,0x88,0x77,0x64,0x32,0x22,0x36,0xbd,0xdd,0xdd,0xdc,0xcb,0xba,0x99,0x88,
+0x88,0x77,0x66,0x55,0x44,0x33,0x33,0x33,0x22,0x23,0x33,0x44,0x55,0x56,0xad,0xdd,
+0xdd,0xcc,0xba,0x99,0x87,0x76,0x65,0x54,0x44,0x55,0x66,0x67,0x89,0x99,0xaa,0xaa,
+0xbc,0xcc,0xcd,0xdd,0xdd,0xdd,0xdb,0x96,0x44,0x8b,0xcd,0xdd,0xdd,0xdc,0xcc,0xcc,
+0xdd,0xdd,0xdd,0xc8,0x32,0x22,0x33,0x33,0x44,0x67,0x99,0xaa,0xbb,0xbb,0xcb,0xbb,
+0xbb,0xbb,0xcc,0xcd,0xdd,0xcc,0xcc,0xbc,0xcc,0xdd,0xdc,0xcc,0xcc,0xcc,0xdd,0xdd,
+0xdd,0xdd,0xdc,0xdd,0xdd,0xdd,0xdc,0xcc,0xcb,0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,0xcb,
+0xba,0xaa,0xaa,0x99,0x99,0x88,0x77,0x65,0x44,0x44,0x43,0x33,0x33,0x34,0x43,0x33,
+0x22,0x22,0x36,0xac,0xdd,0xdd,0xdd,0xdd,0xdd,0xcb,0x73,0x45,0x8b,0xcd,0xdd,0xdd,
+0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xdc,0xcc,0xdd,0xdd,0xdd,0xdd,0xdd,0xdc,0xcb,0xbb,
+0xaa,0xbb,0xbc,0xdd,0xdd,0xdc,0xcc,0xba,0x76,0x66,0x43,0x33,0x68,0xbd,0xdd,0xdd,
+0xcc,0xcc,0xcb,0xbc,0xcb,0xbb,0xa9,0x98,0x87,0x76,0x66,0x55,0x45,0x44,0x44,0x44,
+0x44,0x33,0x22,0x22,0x35,0x9d,0xdd,0xcc,0xcb,0xaa,0xaa,0xa9,0x98,0x76,0x65,0x54,
+0x44,0x44,0x44,0x43,0x43,0x33,0x33,0x34,0x44,0x55,0x43,0x33,0x33,0x33,0x33,0x33,
+0x23,0x33,0x33,0x34,0x44,0x43,0x32,0x22,0x22,0x23,0x7b,0xdd,0xdd,0xdc,0xcb,0xa9,
+0x99,0x99,0x87,0x76,0x55,0x43,0x22,0x23,0x58,0xcd,0xdd,0xcb,0xbb,0xa9,0x98,0x76,
+0x54,0x32,0x22,0x23,0x35,0x8a,0xbc,0xcd,0xdd,0xcc,0xbb,0xba,0xaa,0x99,0x88,0x88,
+0x88,0x87,0x65,0x54,0x43,0x22,0x22,0x22,0x33,0x22,0x33,0x34,0x44,0x33,0x23,0x32,
+0x22,0x22,0x22,0x22,0x23,0x45,0x55,0x6a,0xdd,0xdd,0xcc,0xcd,0xdd,0xdd,0xdd,0xdd,
+0xdd,0xdd,0xdd,0xdd,0xcc,0xcb,0xba,0x99,0x98,0x76,0x65,0x44,0x33,0x32,0x22,0x22,
+0x33,0x33,0x32,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x23,0x33,0x32,
+0x22,0x23,0x33,0x57,0x9a,0xcd,0xdd,0xcb,0xa9,0x87,0x54,0x33,0x22,0x23,0x35,0x8c,
+0xdd,0xdd,0xcc,0xba,0xaa,0xa9,0x98,0x88,0x88,0x99,0x99,0x99,0x88,0x88,0x77,0x76,
+0x65,0x44,0x33,0x32,0x22,0x33,0x45,0x79,0xcb,0xbc,0xcc,0xa9,0xab,0xbc,0xcb,0x98,
+0x89,0xbc,0xdd,0xdd,0xdd,0xdd,0xcc,0xba,0x98,0x77,0x76,0x65,0x44,0x43,0x33,0x32,
+0x22,0x22,0x33,0x45,0x54,0x32,0x23,0x34,0x55,0x65,0x55,0x66,0x66,0x66,0x54,0x44,
+0x33,0x32,0x22,0x22,0x22,0x23,0x33,0x33,0x33,0x33,0x33,0x33,0x44,0x55,0x56,0x67,
+0x78,0x88,0x99,0x99,0x9a,0xbc,0xcc,0xdd,0xdc,0xbb,0xa9,0x9b,0xcd,0xdd,0xdd,0xdd,
+0xcc,0xcc,0xbb,0xa9,0xaa,0xaa,0x99,0x98,0x88,0x76,0x55,0x43,0x32,0x33,0x56,0x8a,
+0xcc,0xdd,0xdd,0xdd,0xcc,0xb9,0x76,0x79,0xbb,0xbb,0xbc,0xcc,0xcd,0xdd,0xdd,0xdd,
+0xdd,0xdd,0xdd,0xcc,0xdd,0xdd,0xcc,0xbb,0xbb,0x99,0xaa,0xbb,0xa9,0x89,0xab,0xcd,
+0xdc,0xbb,0xa9,0x98,0x87,0x65,0x43,0x32,0x23,0x34,0x58,0xbc,0xdd,0xdd,0xcc,0xbb,
+0xaa,0x98,0x87,0x76,0x54,0x33,0x33,0x33,0x22,0x23,0x36,0x9c,0xcc,0xcc,0xcc,0xcc,
+0xbb,0x97,0x53,0x34,0x55,0x66,0x79,0xbc,0xcc,0xdc,0xcc,0xcc,0xcc,0xba,0xaa,0xaa,
+0x99,0x87,0x77,0x77,0x88,0x88,0x77,0x77,0x77,0x76,0x67,0x77,0x77,0x76,0x66,0x77,
+0x88,0x88,0x89,0x9a,0xa9,0x99,0x99,0x99,0x88,0x89,0x99,0xaa,0xaa,0xbb,0xbb,0xbb,
+0xcc,0xcc,0xcc,0xcc,0xcb,0xa9,0x85,0x43,0x33,0x33,0x33,0x34,0x7b,0xcc,0xcc,0xcc,
+0xcc,0xcc,0xcc,0xcb,0xbb,0xaa,0xaa,0xaa,0xbb,0xcc,0xcc,0xcc,0xcc,0xcc,0xbb,0xaa,
+0x85,0x34,0x56,0x9a,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xbb,0xaa,0xaa,
+0xaa,0x99,0x88,0x77,0x88,0x9a,0xaa,0xaa,0x99,0x99,0xaa,0xab,0xbc,0xcc,0xcc,0xb9,
+0x66,0x54,0x44,0x44,0x58,0xab,0xaa,0xab,0xcc,0xcc,0xcc,0xcc,0xcc,0xbb,0xbb,0xaa,
+0xaa,0xaa,0xaa,0xa9,0x88,0x88,0x88,0x9a,0xab,0xbb,0xbb,0xbb,0xaa,0x99,0x87,0x55,
+0x44,0x33,0x33,0x33,0x34,0x7c,0xcc,0xcc,0xbb,0xbb,0xbb,0xaa,0xbb,0xaa,0x98,0x87,
+0x76,0x54,0x44,0x44,0x44,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x45,0x78,
+0x89,0xab,0xcc,0xcc,0xbb,0xaa,0x98,0x76,0x65,0x44,0x33,0x33,0x33,0x33,0x33,0x34,
+0x68,0x9a,0xcc,0xcc,0xcb,0xaa,0x99,0xa9,0x98,0x76,0x65,0x55,0x44,0x33,0x33,0x33,
+0x33,0x46,0x9b,0xcc,0xcc,0xcb,0xa9,0x87,0x65,0x55,0x56,0x66,0x66,0x66,0x77,0x76,
+0x66,0x77,0x66,0x66,0x66,0x55,0x44,0x44,0x33,0x33,0x34,0x68,0xab,0xcc,0xcc,0xcc,
+0xbb,0xba,0xa9,0x99,0x88,0x77,0x66,0x65,0x55,0x55,0x44,0x43,0x33,0x33,0x33,0x44,
+0x56,0x78,0x8a,0xbb,0xa9,0x89,0x89,0xbc,0xcc,0xcb,0xba,0xaa,0x99,0x99,0xaa,0xa9,
+0x99,0x9a,0xaa,0xbb,0xbb,0xbb,0xbb,0xbb,0xba,0xa9,0x99,0x88,0x77,0x76,0x65,0x44,
+0x44,0x44,0x33,0x33,0x34,0x57,0xaa,0xa8,0x9a,0x87,0x78,0x9b,0xbc,0xcc,0xcc,0xcb,
+0xa8,0x75,0x44,0x44,0x55,0x8a,0xbc,0xcc,0xcc,0xcc,0xcc,0xbb,0x85,0x43,0x34,0x6a,
+0xcc,0xbb,0xaa,0xaa,0xaa,0xbb,0xbc,0xcc,0xbb,0xba,0xa9,0x88,0x77,0x77,0x77,0x77,
+0x77,0x77,0x66,0x55,0x54,0x44,0x33,0x33,0x33,0x47,0x8a,0xbb,0xbc,0xcc,0xcc,0xcc,
+0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,
+0x99,0x99,0x88,0x88,0x87,0x77,0x77,0x77,0x66,0x67,0x77,0x77,0x77,0x77,0x76,0x55,
+0x55,0x55,0x44,0x33,0x33,0x33,0x47,0x9b,0xbc,0xcc,0xcc,0xcb,0xba,0xa9,0x87,0x77,
+0x77,0x76,0x54,0x33,0x34,0x68,0xab,0xbb,0xbc,0xcc,0xcc,0xbb,0xbb,0xbb,0xba,0xab,
+0xbb,0xbb,0xaa,0xaa,0x99,0x87,0x77,0x77,0x76,0x66,0x55,0x44,0x43,0x33,0x57,0xab,
+0xbc,0xcc,0xcc,0xcc,0xcb,0xbb,0xbb,0xcc,0xcc,0xcc,0xcc,0xbb,0xa8,0x64,0x33,0x44,
+0x44,0x44,0x44,0x44,0x33,0x34,0x58,0xbc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xa9,
+0x98,0x87,0x66,0x55,0x55,0x55,0x55,0x55,0x56,0x66,0x77,0x88,0x9a,0xaa,0xbb,0xbb,
+0xbb,0xba,0xaa,0xaa,0x99,0x9a,0xa9,0x99,0x99,0x89,0x98,0x87,0x76,0x66,0x65,0x55,
+0x44,0x43,0x34,0x44,0x44,0x43,0x34,0x44,0x44,0x44,0x44,0x44,0x33,0x34,0x46,0x9a,
+0xbb,0xbc,0xcc,0xbb,0xbb,0xaa,0xa9,0x99,0x98,0x88,0x76,0x54,0x34,0x58,0xac,0xcb,
+0xbb,0xaa,0xaa,0xaa,0xa9,0x98,0x87,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,
+0x88,0x88,0x88,0x88,0x88,0x77,0x66,0x66,0x55,0x54,0x44,0x44,0x44,0x44,0x33,0x33,
+0x44,0x55,0x68,0x9a,0xbb,0xbc,0xcc,0xbb,0xbb,0xbb,0xba,0x98,0x76,0x54,0x43,0x34,
+0x44,0x44,0x56,0x78,0xaa,0xbb,0xbb,0xcc,0xbb,0xbb,0xbb,0xbb,0xaa,0x99,0x99,0x88,
+0x77,0x65,0x55,0x55,0x44,0x34,0x44,0x58,0xab,0xcb,0xbb,0xba,0xaa,0x98,0x88,0x78,
+0x89,0x99,0x99,0x98,0x87,0x76,0x65,0x54,0x44,0x43,0x34,0x44,0x45,0x78,0x9a,0xab,
+0xbb,0xbb,0xcb,0xbb,0xbb,0xbb,0xbb,0xbc,0xbb,0xbb,0xcc,0xbb,0xbb,0xbb,0xaa,0x99,
+0x87,0x76,0x54,0x43,0x45,0x7a,0xbb,0xbb,0xba,0xa9,0x98,0x76,0x65,0x54,0x44,0x44,
+0x44,0x44,0x44,0x55,0x7a,0xbb,0xbb,0xbb,0xba,0xa9,0x98,0x88,0x77,0x66,0x66,0x55,
+0x44,0x44,0x44,0x44,0x57,0x9a,0xbb,0xbb,0xba,0xa9,0x87,0x66,0x54,0x44,0x45,0x57,
+0x9a,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0x98,0x87,0x76,0x66,0x66,0x55,0x55,0x54,0x44,
+0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x56,0x67,0x8a,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0xa9,0x98,0x88,0x88,0x88,0x87,0x77,0x66,0x55,0x54,
+0x44,0x44,0x44,0x44,0x56,0x78,0x9a,0xbb,0xbb,0xbb,0xbb,0xbb,0xba,0xaa,0xaa,0xbb,
+0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0xaa,0xa9,0x99,0x88,0x88,
+0x77,0x77,0x77,0x77,0x76,0x67,0x77,0x88,0x89,0x99,0x99,0x99,0x99,0x99,0xaa,0xaa,
+0xaa,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0xaa,0xaa,0xaa,0x99,0x88,0x88,0x77,
+0x77,0x77,0x78,0x89,0x99,0x88,0x99,0x99,0x99,0x99,0x9a,0xaa,0xaa,0xaa,0xab,0xbb,
+0xba,0xaa,0xaa,0xaa,0xaa,0xa9,0x99,0x99,0x99,0x99,0x99,0x9a,0xaa,0xbb,0xaa,0xab,
+0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xaa,0xa9,0x9a,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xba,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xab,
+0xaa,0x98,0x65,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x45,
+0x55,0x44,0x44,0x44,0x44,0x45,0x55,0x44,0x55,0x67,0x88,0x99,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xaa,0x99,0x99,0x99,0x99,0x88,0x88,0x88,0x87,0x76,0x65,0x55,0x55,0x55,0x55,
+0x55,0x68,0x99,0xaa,0xaa,0xaa,0xa9,0x99,0x98,0x77,0x66,0x55,0x55,0x55,0x55,0x66,
+0x66,0x67,0x77,0x77,0x88,0x88,0x88,0x88,0x87,0x76,0x65,0x55,0x55,0x55,0x55,0x55,
+0x55,0x55,0x56,0x66,0x66,0x66,0x66,0x66,0x67,0x77,0x77,0x77,0x77,0x77,0x88,0x88,
+0x88,0x88,0x99,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xa9,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x88,0x88,0x88,0x88,
+0x99,0x99,0x88,0x88,0x99,0x99,0x99,0xaa,0xaa,0xa9,0x99,0x9a,0xa9,0x99,0x99,0x99,
+0x98,0x89,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+};
@@ -0,0 +1,11 @@
+//AUTOGENERATED FILE FROM cvtsample
+#ifndef WAVE_SOUND_sfx_expl_ship_H
+#define WAVE_SOUND_sfx_expl_ship_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define sfx_expl_ship_SIZE 0xc80
+extern const uint8_t sfx_expl_ship[];
+
+BANKREF_EXTERN(sfx_expl_ship)
+#endif
@@ -0,0 +1,183 @@
+//AUTOGENERATED FILE FROM cvtsample
+#include <stdint.h>
+#include <gbdk/platform.h>
+BANKREF(sfx_heal)
+const uint8_t sfx_heal[] = {
+0x87,0x87,0x87,0x88,0x88,0x88,0x88,0x88,0x87,0x77,0x77,0x77,0x77,0x77,0x78,0x88,
+0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+0x88,0x88,0x78,0x77,0x77,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x89,0x98,0x88,0x88,
+0x77,0x76,0x66,0x67,0x77,0x78,0x88,0x89,0x99,0x99,0x99,0x99,0x99,0x88,0x99,0x99,
+0x99,0x99,0x99,0x99,0x99,0x98,0x88,0x88,0x88,0x87,0x77,0x77,0x77,0x77,0x78,0x88,
+0x88,0x89,0x99,0x99,0x99,0x98,0x87,0x76,0x66,0x66,0x66,0x77,0x88,0x89,0x99,0x99,
+0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x98,0x88,0x88,
+0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x99,0x99,0xaa,0xaa,0xa9,0x98,0x76,0x65,0x55,
+0x55,0x66,0x78,0x89,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xaa,0xa9,0x99,0x98,0x88,0x87,0x77,0x77,0x77,0x77,0x78,0x88,0x99,0x9a,0xaa,
+0xaa,0xaa,0x98,0x77,0x65,0x55,0x55,0x56,0x77,0x89,0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xa9,0x99,0x98,0x88,0x87,0x77,0x77,0x77,
+0x77,0x78,0x88,0x99,0x9a,0xaa,0xbb,0xaa,0x98,0x87,0x65,0x54,0x45,0x56,0x77,0x89,
+0xaa,0xab,0xbb,0xbb,0xba,0xaa,0xaa,0xaa,0xaa,0xab,0xbb,0xbb,0xbb,0xba,0xaa,0xa9,
+0x99,0x88,0x87,0x77,0x77,0x77,0x77,0x78,0x88,0x99,0xaa,0xbb,0xbb,0xba,0xa9,0x76,
+0x54,0x44,0x44,0x56,0x78,0x99,0xab,0xbb,0xcb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,0xbb,
+0xbb,0xcc,0xbb,0xbb,0xba,0xa9,0x99,0x88,0x87,0x77,0x77,0x77,0x77,0x78,0x89,0xaa,
+0xbb,0xcc,0xcc,0xba,0x98,0x75,0x43,0x33,0x34,0x56,0x78,0x9a,0xbc,0xcc,0xcc,0xcc,
+0xcb,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,0xcc,0xcb,0xba,0xa9,0x98,0x88,0x77,0x77,
+0x77,0x77,0x77,0x89,0x9a,0xab,0xcc,0xcc,0xcb,0xa9,0x86,0x54,0x33,0x33,0x45,0x68,
+0x9a,0xbb,0xcc,0xcc,0xcc,0xcc,0xbb,0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,
+0xaa,0x99,0x88,0x77,0x77,0x77,0x77,0x77,0x88,0x99,0xab,0xbc,0xcc,0xcc,0xba,0x97,
+0x65,0x43,0x33,0x34,0x57,0x89,0xab,0xcc,0xcc,0xcc,0xcc,0xcb,0xbb,0xbb,0xbc,0xcc,
+0xcc,0xcc,0xcc,0xcc,0xbb,0xba,0xa9,0x98,0x87,0x77,0x77,0x77,0x77,0x88,0x99,0xaa,
+0xbc,0xcc,0xcc,0xba,0x98,0x65,0x43,0x22,0x34,0x56,0x89,0xab,0xcc,0xcd,0xdc,0xcc,
+0xcc,0xcc,0xbc,0xcc,0xcc,0xcc,0xdd,0xdc,0xcc,0xcb,0xba,0xa9,0x98,0x87,0x77,0x76,
+0x67,0x77,0x88,0x99,0xab,0xbc,0xcd,0xdc,0xba,0x98,0x65,0x33,0x22,0x34,0x57,0x89,
+0xab,0xcc,0xdd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xcc,0xcb,0xba,
+0x99,0x88,0x77,0x77,0x66,0x77,0x77,0x88,0x9a,0xab,0xcc,0xdd,0xcc,0xb9,0x86,0x53,
+0x32,0x23,0x45,0x78,0x9a,0xbc,0xcd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xcc,0xdd,
+0xdd,0xcc,0xcb,0xba,0xa9,0x98,0x87,0x77,0x77,0x67,0x77,0x78,0x89,0x9a,0xbc,0xcd,
+0xdc,0xcb,0xa9,0x75,0x43,0x22,0x33,0x46,0x78,0xab,0xbc,0xdd,0xdd,0xcc,0xcc,0xcc,
+0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xcc,0xcb,0xba,0xa9,0x98,0x87,0x77,0x76,0x67,0x77,
+0x78,0x99,0xab,0xbc,0xdd,0xdc,0xca,0x97,0x64,0x32,0x22,0x34,0x57,0x8a,0xbc,0xcd,
+0xdd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xdc,0xcb,0xba,0xa9,0x98,0x77,
+0x77,0x66,0x77,0x77,0x89,0x9a,0xbc,0xcd,0xdd,0xcb,0xa8,0x65,0x32,0x22,0x34,0x57,
+0x8a,0xbc,0xcd,0xdd,0xdd,0xdc,0xcc,0xcc,0xcc,0xcc,0xdd,0xdd,0xdd,0xdc,0xcc,0xba,
+0xa9,0x88,0x77,0x77,0x66,0x67,0x77,0x89,0x9a,0xbc,0xdd,0xdd,0xcb,0xa8,0x65,0x32,
+0x22,0x34,0x57,0x8a,0xbc,0xdd,0xdd,0xdd,0xdc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xdd,
+0xdc,0xcb,0xba,0xa9,0x88,0x77,0x76,0x66,0x67,0x77,0x89,0xaa,0xbc,0xdd,0xdd,0xcb,
+0xa8,0x65,0x32,0x22,0x34,0x57,0x8a,0xbc,0xdd,0xdd,0xdd,0xdc,0xcc,0xcc,0xcc,0xcd,
+0xdd,0xdd,0xdd,0xdc,0xcc,0xba,0xa9,0x88,0x77,0x76,0x66,0x77,0x78,0x89,0xab,0xcc,
+0xdd,0xdd,0xcb,0x97,0x54,0x22,0x22,0x34,0x68,0x9b,0xcd,0xdd,0xdd,0xdd,0xdc,0xcc,
+0xcc,0xcd,0xdd,0xdd,0xdd,0xdd,0xdc,0xcb,0xaa,0x99,0x87,0x77,0x66,0x66,0x77,0x88,
+0x9a,0xbc,0xcd,0xdd,0xdc,0xb9,0x76,0x42,0x21,0x23,0x46,0x89,0xbc,0xdd,0xde,0xdd,
+0xdd,0xdc,0xcc,0xcd,0xdd,0xdd,0xde,0xed,0xdd,0xcc,0xba,0xa9,0x88,0x77,0x76,0x66,
+0x67,0x78,0x89,0xab,0xcd,0xde,0xed,0xcb,0x97,0x53,0x21,0x12,0x35,0x68,0xab,0xcd,
+0xde,0xed,0xdd,0xdd,0xcc,0xcd,0xdd,0xdd,0xde,0xee,0xdd,0xdc,0xbb,0xa9,0x98,0x77,
+0x76,0x66,0x67,0x78,0x89,0xab,0xcd,0xde,0xed,0xcb,0x97,0x53,0x21,0x12,0x35,0x68,
+0xab,0xcd,0xde,0xed,0xdd,0xdd,0xcc,0xcc,0xdd,0xdd,0xdd,0xee,0xdd,0xdc,0xcb,0xaa,
+0x98,0x87,0x77,0x66,0x67,0x77,0x89,0x9a,0xbc,0xdd,0xed,0xdc,0xa8,0x64,0x32,0x11,
+0x24,0x57,0x9a,0xcd,0xde,0xee,0xdd,0xdd,0xdc,0xcd,0xdd,0xdd,0xde,0xee,0xed,0xdd,
+0xcb,0xba,0x99,0x87,0x77,0x66,0x66,0x77,0x88,0x9a,0xbc,0xdd,0xee,0xdc,0xb9,0x75,
+0x32,0x11,0x23,0x57,0x9a,0xbd,0xde,0xee,0xed,0xdd,0xdd,0xdd,0xdd,0xdd,0xee,0xee,
+0xee,0xdd,0xcc,0xba,0x99,0x87,0x77,0x66,0x66,0x77,0x89,0x9a,0xbc,0xde,0xee,0xdc,
+0xa8,0x64,0x31,0x11,0x23,0x57,0x9b,0xcd,0xee,0xee,0xed,0xdd,0xdd,0xdd,0xdd,0xde,
+0xee,0xee,0xee,0xdd,0xcb,0xaa,0x98,0x87,0x76,0x66,0x67,0x77,0x89,0xab,0xcd,0xee,
+0xee,0xdb,0x97,0x53,0x21,0x12,0x34,0x68,0xab,0xdd,0xee,0xee,0xed,0xdd,0xdd,0xdd,
+0xdd,0xde,0xee,0xee,0xed,0xdc,0xcb,0xa9,0x98,0x77,0x76,0x66,0x67,0x78,0x89,0xab,
+0xcd,0xee,0xed,0xcb,0x97,0x53,0x21,0x12,0x35,0x68,0xac,0xdd,0xee,0xee,0xed,0xdd,
+0xdd,0xdd,0xdd,0xde,0xee,0xee,0xed,0xdc,0xbb,0xa9,0x98,0x77,0x66,0x66,0x67,0x78,
+0x9a,0xbc,0xdd,0xee,0xed,0xca,0x86,0x42,0x11,0x12,0x46,0x8a,0xbc,0xde,0xee,0xee,
+0xed,0xdd,0xdd,0xdd,0xde,0xee,0xee,0xee,0xed,0xcc,0xba,0x99,0x87,0x76,0x66,0x66,
+0x77,0x89,0xab,0xcd,0xee,0xee,0xdc,0xa8,0x63,0x21,0x11,0x24,0x68,0xab,0xde,0xee,
+0xee,0xee,0xdd,0xdd,0xdd,0xde,0xee,0xee,0xee,0xee,0xdc,0xcb,0xa9,0x88,0x77,0x66,
+0x66,0x67,0x78,0x9a,0xbc,0xde,0xee,0xed,0xb9,0x75,0x31,0x11,0x13,0x57,0x9b,0xcd,
+0xee,0xee,0xee,0xed,0xdd,0xdd,0xde,0xee,0xee,0xee,0xee,0xdd,0xcb,0xa9,0x98,0x77,
+0x66,0x66,0x67,0x78,0x9a,0xbc,0xde,0xee,0xed,0xb9,0x75,0x31,0x1,0x13,0x57,0x9b,
+0xcd,0xee,0xee,0xee,0xed,0xdd,0xdd,0xde,0xee,0xee,0xfe,0xee,0xdd,0xcb,0xaa,0x98,
+0x77,0x66,0x66,0x67,0x78,0x9a,0xbc,0xde,0xef,0xed,0xc9,0x75,0x31,0x0,0x13,0x57,
+0x9b,0xcd,0xef,0xff,0xee,0xed,0xdd,0xdd,0xee,0xee,0xff,0xfe,0xee,0xdc,0xbb,0xa9,
+0x87,0x76,0x66,0x66,0x77,0x89,0xac,0xde,0xef,0xee,0xca,0x75,0x31,0x0,0x13,0x57,
+0x9b,0xde,0xef,0xff,0xee,0xee,0xdd,0xde,0xee,0xef,0xff,0xff,0xee,0xdc,0xba,0x99,
+0x87,0x76,0x66,0x66,0x78,0x9a,0xbc,0xde,0xff,0xed,0xc9,0x74,0x21,0x0,0x13,0x58,
+0xac,0xde,0xff,0xff,0xee,0xee,0xdd,0xee,0xee,0xff,0xff,0xff,0xed,0xdc,0xba,0x98,
+0x87,0x66,0x66,0x67,0x78,0x9a,0xbd,0xef,0xff,0xec,0xa8,0x53,0x10,0x1,0x35,0x79,
+0xbd,0xef,0xff,0xfe,0xee,0xed,0xde,0xee,0xee,0xff,0xff,0xfe,0xed,0xcb,0xa9,0x88,
+0x77,0x66,0x66,0x77,0x89,0xab,0xcd,0xef,0xfe,0xdb,0x96,0x42,0x0,0x2,0x46,0x8a,
+0xcd,0xef,0xff,0xfe,0xee,0xed,0xde,0xee,0xef,0xff,0xff,0xee,0xdc,0xbb,0xa9,0x87,
+0x76,0x66,0x66,0x77,0x89,0xbc,0xde,0xff,0xfe,0xca,0x75,0x21,0x0,0x13,0x57,0xac,
+0xde,0xff,0xff,0xfe,0xee,0xee,0xee,0xee,0xff,0xff,0xff,0xee,0xdc,0xba,0x98,0x77,
+0x66,0x66,0x67,0x78,0x9a,0xcd,0xef,0xff,0xec,0xa7,0x52,0x10,0x1,0x35,0x7a,0xcd,
+0xef,0xff,0xff,0xee,0xee,0xee,0xee,0xff,0xff,0xff,0xfe,0xed,0xcb,0xa9,0x87,0x76,
+0x66,0x66,0x78,0x8a,0xbc,0xde,0xff,0xfe,0xc9,0x74,0x20,0x0,0x13,0x68,0xac,0xef,
+0xff,0xff,0xfe,0xee,0xee,0xee,0xff,0xff,0xff,0xff,0xed,0xcb,0xa9,0x98,0x77,0x66,
+0x66,0x77,0x89,0xab,0xce,0xff,0xff,0xdb,0x96,0x41,0x0,0x2,0x46,0x8a,0xce,0xff,
+0xff,0xff,0xee,0xee,0xee,0xee,0xff,0xff,0xff,0xfe,0xdd,0xcb,0xa9,0x87,0x76,0x66,
+0x66,0x78,0x8a,0xbc,0xde,0xff,0xfe,0xc9,0x74,0x20,0x0,0x13,0x68,0xac,0xef,0xff,
+0xff,0xfe,0xee,0xee,0xee,0xff,0xff,0xff,0xff,0xed,0xcb,0xa9,0x88,0x76,0x66,0x66,
+0x77,0x89,0xac,0xde,0xff,0xfe,0xda,0x85,0x21,0x0,0x12,0x57,0xac,0xde,0xff,0xff,
+0xfe,0xee,0xee,0xee,0xef,0xff,0xff,0xff,0xed,0xcb,0xa9,0x98,0x77,0x66,0x66,0x77,
+0x89,0xab,0xde,0xff,0xfe,0xda,0x85,0x31,0x0,0x13,0x57,0xac,0xde,0xff,0xff,0xfe,
+0xee,0xee,0xee,0xef,0xff,0xff,0xfe,0xed,0xcb,0xa9,0x88,0x76,0x66,0x66,0x77,0x89,
+0xac,0xde,0xff,0xfe,0xc9,0x74,0x20,0x0,0x24,0x68,0xbc,0xef,0xff,0xff,0xee,0xee,
+0xee,0xee,0xef,0xff,0xff,0xfe,0xdd,0xcb,0xa9,0x87,0x76,0x66,0x66,0x78,0x9a,0xbc,
+0xef,0xff,0xed,0xb8,0x53,0x10,0x1,0x25,0x79,0xbd,0xef,0xff,0xff,0xee,0xee,0xee,
+0xee,0xef,0xff,0xff,0xfe,0xdd,0xcb,0xa9,0x87,0x76,0x66,0x67,0x78,0x9a,0xbd,0xef,
+0xff,0xed,0xa8,0x53,0x10,0x1,0x35,0x8a,0xcd,0xef,0xff,0xfe,0xee,0xee,0xee,0xee,
+0xff,0xff,0xff,0xee,0xdc,0xba,0x98,0x77,0x66,0x66,0x67,0x89,0xab,0xcd,0xef,0xfe,
+0xdb,0x86,0x31,0x0,0x12,0x57,0x9b,0xde,0xff,0xff,0xee,0xee,0xdd,0xee,0xee,0xff,
+0xff,0xfe,0xed,0xcb,0xa9,0x88,0x76,0x66,0x66,0x78,0x8a,0xbc,0xde,0xff,0xed,0xb8,
+0x63,0x10,0x1,0x35,0x79,0xbd,0xef,0xff,0xee,0xee,0xdd,0xde,0xee,0xef,0xff,0xfe,
+0xed,0xdc,0xba,0x98,0x77,0x66,0x66,0x77,0x89,0xab,0xcd,0xef,0xfe,0xca,0x75,0x21,
+0x1,0x24,0x68,0xac,0xde,0xff,0xee,0xee,0xdd,0xdd,0xee,0xee,0xff,0xfe,0xed,0xdc,
+0xba,0x98,0x77,0x66,0x66,0x77,0x89,0xab,0xde,0xef,0xed,0xc9,0x74,0x21,0x1,0x24,
+0x79,0xbd,0xee,0xff,0xee,0xee,0xdd,0xdd,0xee,0xef,0xff,0xfe,0xed,0xdc,0xba,0x98,
+0x77,0x66,0x66,0x77,0x89,0xab,0xcd,0xef,0xfe,0xca,0x75,0x21,0x1,0x24,0x68,0xac,
+0xde,0xff,0xfe,0xee,0xdd,0xdd,0xee,0xee,0xff,0xfe,0xee,0xdc,0xba,0x98,0x87,0x66,
+0x66,0x67,0x88,0x9b,0xcd,0xef,0xfe,0xdb,0x86,0x31,0x0,0x13,0x58,0xac,0xde,0xef,
+0xee,0xee,0xdd,0xdd,0xde,0xee,0xef,0xee,0xed,0xdc,0xba,0x98,0x77,0x66,0x66,0x77,
+0x89,0xac,0xde,0xee,0xec,0xa7,0x53,0x11,0x12,0x47,0x9b,0xde,0xee,0xee,0xed,0xdd,
+0xdd,0xde,0xee,0xee,0xee,0xed,0xcb,0xa9,0x98,0x77,0x66,0x66,0x78,0x89,0xbc,0xde,
+0xee,0xdc,0x97,0x42,0x11,0x13,0x57,0x9b,0xde,0xee,0xee,0xed,0xdd,0xdd,0xde,0xee,
+0xee,0xee,0xed,0xcb,0xa9,0x98,0x77,0x66,0x66,0x78,0x89,0xbc,0xde,0xee,0xdc,0x97,
+0x52,0x11,0x13,0x57,0x9b,0xde,0xee,0xee,0xed,0xdd,0xdd,0xde,0xee,0xee,0xee,0xed,
+0xcb,0xa9,0x98,0x77,0x66,0x66,0x78,0x89,0xbc,0xde,0xee,0xdc,0x97,0x42,0x11,0x13,
+0x57,0x9b,0xde,0xee,0xee,0xed,0xdd,0xdd,0xdd,0xee,0xee,0xee,0xdd,0xcb,0xa9,0x88,
+0x77,0x66,0x67,0x78,0x9a,0xbc,0xde,0xee,0xdb,0x96,0x42,0x11,0x23,0x68,0xac,0xde,
+0xee,0xee,0xdd,0xdd,0xdd,0xde,0xee,0xee,0xee,0xdc,0xbb,0xa9,0x87,0x76,0x66,0x67,
+0x78,0x9a,0xbd,0xee,0xed,0xca,0x75,0x31,0x11,0x35,0x79,0xbd,0xde,0xee,0xed,0xdd,
+0xdd,0xdd,0xde,0xee,0xee,0xed,0xcc,0xba,0x98,0x77,0x66,0x66,0x77,0x89,0xab,0xcd,
+0xee,0xdc,0xa8,0x53,0x11,0x13,0x57,0x9b,0xcd,0xee,0xee,0xdd,0xdd,0xdd,0xdd,0xde,
+0xee,0xee,0xdc,0xcb,0xa9,0x87,0x76,0x66,0x67,0x78,0x9a,0xbc,0xde,0xed,0xca,0x85,
+0x32,0x11,0x24,0x69,0xac,0xde,0xee,0xed,0xdd,0xdd,0xdd,0xdd,0xee,0xee,0xed,0xdc,
+0xba,0x99,0x87,0x76,0x66,0x67,0x88,0x9a,0xcd,0xee,0xed,0xb9,0x74,0x21,0x12,0x35,
+0x8a,0xbd,0xee,0xee,0xdd,0xdd,0xdd,0xdd,0xde,0xee,0xee,0xdd,0xcb,0xa9,0x98,0x77,
+0x66,0x66,0x78,0x89,0xbc,0xde,0xee,0xdb,0x96,0x42,0x11,0x24,0x68,0xac,0xde,0xee,
+0xed,0xdd,0xdd,0xdd,0xdd,0xee,0xee,0xed,0xcc,0xba,0x98,0x87,0x76,0x66,0x77,0x89,
+0xab,0xcd,0xee,0xdc,0xa8,0x53,0x21,0x23,0x57,0x9b,0xcd,0xee,0xed,0xdd,0xdc,0xcd,
+0xdd,0xde,0xee,0xdd,0xdc,0xba,0x99,0x87,0x76,0x66,0x77,0x89,0xab,0xcd,0xde,0xdc,
+0xa8,0x63,0x21,0x23,0x57,0x9b,0xcd,0xde,0xdd,0xdd,0xcc,0xcd,0xdd,0xdd,0xee,0xdd,
+0xdc,0xba,0x99,0x87,0x76,0x66,0x77,0x89,0xab,0xcd,0xde,0xdc,0xa8,0x53,0x21,0x23,
+0x57,0x9b,0xcd,0xde,0xdd,0xdd,0xcc,0xcd,0xdd,0xdd,0xee,0xdd,0xcc,0xba,0x98,0x87,
+0x76,0x66,0x77,0x89,0xab,0xcd,0xde,0xdc,0xa8,0x63,0x21,0x23,0x57,0x9b,0xcd,0xde,
+0xdd,0xdd,0xcc,0xcd,0xdd,0xdd,0xee,0xdd,0xdc,0xba,0x99,0x87,0x76,0x66,0x77,0x89,
+0x9b,0xcd,0xde,0xdc,0xa8,0x53,0x21,0x23,0x57,0x9b,0xcd,0xdd,0xdd,0xdd,0xcc,0xcc,
+0xdd,0xdd,0xdd,0xdd,0xcc,0xba,0x98,0x87,0x76,0x66,0x77,0x89,0xab,0xcd,0xdd,0xdb,
+0x97,0x53,0x22,0x24,0x68,0xab,0xcd,0xdd,0xdd,0xdc,0xcc,0xcc,0xdd,0xdd,0xdd,0xdc,
+0xcb,0xa9,0x98,0x77,0x66,0x67,0x78,0x89,0xab,0xcd,0xdd,0xca,0x86,0x42,0x22,0x35,
+0x79,0xbc,0xdd,0xdd,0xdd,0xcc,0xcc,0xcd,0xdd,0xdd,0xdd,0xdc,0xba,0xa9,0x87,0x77,
+0x66,0x77,0x88,0x9a,0xbc,0xdd,0xdc,0xa8,0x64,0x22,0x23,0x57,0x9b,0xcd,0xdd,0xdd,
+0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xdd,0xcb,0xaa,0x98,0x87,0x76,0x67,0x77,0x89,0xab,
+0xcd,0xdd,0xcb,0x96,0x43,0x22,0x34,0x68,0xac,0xcd,0xdd,0xdd,0xcc,0xcc,0xcc,0xdd,
+0xdd,0xdd,0xdc,0xcb,0xa9,0x98,0x77,0x66,0x67,0x78,0x99,0xbc,0xdd,0xdd,0xb9,0x75,
+0x32,0x22,0x46,0x8a,0xbc,0xdd,0xdd,0xdc,0xcc,0xcc,0xcc,0xdd,0xdd,0xdd,0xcc,0xba,
+0x98,0x87,0x76,0x66,0x77,0x89,0xab,0xcd,0xdd,0xcb,0x97,0x53,0x22,0x34,0x68,0xab,
+0xcd,0xdd,0xdc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdd,0xcc,0xbb,0xa9,0x88,0x77,0x66,0x77,
+0x78,0x9a,0xbc,0xcd,0xdc,0xa9,0x64,0x32,0x23,0x57,0x9a,0xcc,0xdd,0xdc,0xcc,0xcc,
+0xcc,0xcc,0xdd,0xdd,0xcc,0xbb,0xa9,0x88,0x77,0x66,0x77,0x88,0x9a,0xbc,0xdd,0xcb,
+0x97,0x53,0x22,0x35,0x79,0xac,0xcd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdc,0xcb,
+0xa9,0x98,0x77,0x76,0x67,0x78,0x9a,0xbc,0xcd,0xdc,0xa8,0x64,0x32,0x34,0x68,0x9b,
+0xcd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xdc,0xcb,0xba,0x98,0x87,0x77,0x67,0x77,
+0x89,0xab,0xcd,0xdc,0xba,0x85,0x42,0x23,0x46,0x8a,0xbc,0xdd,0xdc,0xcc,0xcc,0xcc,
+0xcc,0xdd,0xdd,0xcc,0xbb,0xa9,0x88,0x77,0x66,0x77,0x78,0x9a,0xbc,0xdd,0xcb,0x97,
+0x53,0x22,0x35,0x79,0xab,0xcd,0xdd,0xcc,0xcc,0xcc,0xcc,0xcd,0xdd,0xcc,0xcb,0xa9,
+0x98,0x77,0x76,0x77,0x78,0x9a,0xbc,0xcd,0xcb,0xa8,0x64,0x32,0x34,0x68,0xab,0xcc,
+0xdc,0xcc,0xcc,0xcc,0xcc,0xcc,0xdd,0xcc,0xcb,0xa9,0x98,0x77,0x76,0x77,0x78,0x89,
+0xab,0xcc,0xcc,0xa8,0x64,0x32,0x34,0x68,0x9b,0xcc,0xcc,0xcc,0xcb,0xbb,0xcc,0xcc,
+0xcc,0xcc,0xbb,0xa9,0x98,0x77,0x77,0x77,0x78,0x89,0xab,0xcc,0xcb,0xa8,0x64,0x33,
+0x34,0x68,0xab,0xcc,0xcc,0xcc,0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,0xbb,0xa9,0x98,0x77,
+0x77,0x77,0x78,0x99,0xab,0xcc,0xcb,0xa8,0x64,0x33,0x35,0x68,0xab,0xcc,0xcc,0xcc,
+0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,0xbb,0xa9,0x98,0x77,0x77,0x77,0x78,0x89,0xab,0xcc,
+0xcb,0xa8,0x64,0x33,0x34,0x68,0xab,0xcc,0xcc,0xcc,0xbb,0xbb,0xbc,0xcc,0xcc,0xcc,
+0xbb,0xa9,0x88,0x77,0x77,0x77,0x78,0x99,0xab,0xcc,0xcb,0x97,0x54,0x33,0x45,0x78,
+0xab,0xbc,0xcc,0xbb,0xbb,0xbb,0xbb,0xcc,0xcc,0xbb,0xba,0x99,0x88,0x77,0x77,0x77,
+0x88,0x9a,0xab,0xbb,0xba,0x86,0x54,0x44,0x56,0x89,0xab,0xbb,0xbb,0xbb,0xaa,0xab,
+0xbb,0xbb,0xbb,0xba,0xa9,0x98,0x87,0x77,0x77,0x77,0x89,0x9a,0xab,0xba,0x98,0x75,
+0x54,0x45,0x68,0x9a,0xab,0xbb,0xaa,0xaa,0xaa,0xaa,0xaa,0xbb,0xaa,0xa9,0x99,0x88,
+0x77,0x77,0x77,0x78,0x89,0x9a,0xaa,0xa9,0x87,0x65,0x55,0x67,0x89,0x9a,0xaa,0xaa,
+0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x99,0x88,0x87,0x77,0x77,0x77,0x88,0x99,0xaa,
+0xaa,0x98,0x76,0x55,0x55,0x67,0x89,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+0xaa,0x99,0x88,0x87,0x77,0x77,0x78,0x89,0x9a,0xaa,0xaa,0x98,0x65,0x55,0x56,0x78,
+0x9a,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x99,0x88,0x87,0x77,0x77,0x77,
+0x88,0x89,0x9a,0xa9,0x98,0x76,0x66,0x66,0x77,0x89,0x99,0x99,0x99,0x99,0x99,0x99,
+0x99,0x99,0x99,0x88,0x88,0x88,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x88,0x87,0x77,
+0x77,0x77,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x77,
+0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x87,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x88,
+};
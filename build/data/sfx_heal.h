@@ -0,0 +1,11 @@
+//AUTOGENERATED FILE FROM cvtsample
+#ifndef WAVE_SOUND_sfx_heal_H
+#define WAVE_SOUND_sfx_heal_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define sfx_heal_SIZE 0xb10
+extern const uint8_t sfx_heal[];
+
+BANKREF_EXTERN(sfx_heal)
+#endif
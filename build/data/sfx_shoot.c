@@ -0,0 +1,77 @@
+//AUTOGENERATED FILE FROM cvtsample
+#include <stdint.h>
+#include <gbdk/platform.h>
+BANKREF(sfx_shoot)
+const uint8_t sfx_shoot[] = {
+0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x78,0x9a,0xbc,0xcb,0xa8,0x75,0x43,0x7b,
+0xb7,0x54,0x55,0x65,0x54,0x34,0x58,0xad,0xed,0x99,0x9b,0x36,0x84,0x82,0x6b,0x49,
+0xe9,0xa8,0x98,0xa2,0x44,0x33,0x5,0x34,0xde,0x86,0x47,0x9b,0x53,0x56,0x35,0x65,
+0x7a,0xc5,0x86,0x79,0x96,0x67,0x47,0xa8,0x77,0xd9,0x4a,0x4a,0xc9,0x88,0x92,0x79,
+0x77,0x7b,0x87,0x97,0x9a,0x98,0x88,0x58,0x86,0xbb,0xb9,0x58,0x88,0x89,0x66,0xb9,
+0xb6,0x5a,0x8a,0x97,0x78,0x79,0x88,0x69,0x89,0x76,0x88,0x96,0x56,0xb7,0x89,0x86,
+0x79,0x56,0x6a,0x79,0x86,0x78,0x97,0x97,0x86,0x87,0x67,0x89,0x79,0x68,0xa9,0x57,
+0x87,0x88,0x88,0x67,0xc7,0x68,0x78,0x97,0x78,0x78,0x77,0x97,0x68,0x88,0x89,0x79,
+0x94,0x59,0x87,0x98,0x76,0x87,0x55,0xa9,0x89,0x76,0x68,0x88,0x98,0x87,0x68,0x66,
+0x77,0x98,0x68,0x88,0x6a,0x98,0x97,0x74,0x68,0x87,0x98,0x89,0x76,0x57,0x8a,0x79,
+0x97,0x65,0x67,0x78,0xa8,0x77,0x56,0x66,0x9a,0x9a,0xb9,0x76,0x66,0x87,0x88,0x78,
+0x76,0x54,0x78,0xab,0xaa,0x86,0x67,0x87,0x68,0x87,0x99,0x87,0x88,0x99,0x79,0x86,
+0x89,0x87,0x88,0x87,0x98,0x66,0x77,0x8b,0x98,0x77,0x86,0x96,0x68,0x88,0x78,0x79,
+0x67,0x76,0x87,0x65,0x99,0x9a,0x99,0x77,0x66,0x57,0x96,0x78,0x97,0x97,0x6a,0xaa,
+0x99,0x88,0x56,0x74,0x89,0x98,0x78,0x9b,0x97,0x88,0x99,0x86,0x56,0x88,0x77,0x9a,
+0x79,0xab,0xba,0x99,0x76,0x97,0x57,0x79,0x96,0x58,0xa8,0x88,0x9b,0xbb,0x96,0x69,
+0x97,0x65,0x87,0x56,0x8a,0x99,0x9a,0xa9,0xba,0x67,0x99,0x76,0x89,0xa8,0x88,0x77,
+0x66,0x8a,0x97,0x86,0x78,0x78,0x87,0x78,0x87,0x77,0x79,0x86,0x9b,0xaa,0x97,0x67,
+0x78,0x75,0x67,0x77,0x55,0x79,0x88,0xa9,0x79,0x95,0x56,0x66,0x65,0x79,0x86,0x88,
+0x89,0x9a,0xb9,0x67,0x75,0x68,0x89,0x87,0x67,0x87,0x88,0x67,0xa8,0x77,0x67,0x76,
+0x68,0x97,0x68,0x86,0x66,0x89,0x76,0x76,0x66,0x78,0x98,0x87,0x78,0x89,0x97,0x68,
+0xa9,0x76,0x77,0x66,0x79,0xa9,0x67,0x99,0x99,0xa9,0x65,0x67,0x65,0x55,0x55,0x56,
+0x8a,0x97,0x89,0x97,0x79,0x97,0x67,0x77,0x65,0x56,0x87,0x67,0x87,0x67,0x9a,0x99,
+0xaa,0x99,0x99,0x98,0x64,0x57,0x76,0x56,0x78,0x77,0x76,0x67,0x76,0x78,0xa9,0x75,
+0x66,0x87,0x66,0x79,0xaa,0x99,0x98,0x89,0x98,0x77,0x77,0x65,0x56,0x88,0x66,0x67,
+0x77,0x77,0x78,0xaa,0x86,0x66,0x66,0x67,0x88,0x87,0x66,0x77,0x77,0x65,0x68,0xaa,
+0x98,0x87,0x66,0x89,0xaa,0xa9,0x89,0x98,0x65,0x56,0x89,0xaa,0x87,0x66,0x78,0x9a,
+0xaa,0xaa,0xaa,0x97,0x55,0x67,0x77,0x78,0x98,0x87,0x88,0x9a,0xa9,0x87,0x8a,0xa8,
+0x77,0x88,0x75,0x57,0x99,0x99,0x99,0xab,0xba,0x76,0x68,0x88,0x65,0x68,0x98,0x89,
+0x9a,0xaa,0x99,0x87,0x78,0x88,0x88,0x98,0x66,0x79,0xaa,0x99,0xaa,0xa9,0x87,0x78,
+0x9a,0xaa,0xa9,0x87,0x65,0x67,0x89,0x88,0x89,0xab,0xa8,0x66,0x67,0x78,0x9a,0x97,
+0x65,0x56,0x67,0x77,0x78,0xaa,0x97,0x65,0x55,0x68,0x9a,0xa9,0x87,0x66,0x77,0x77,
+0x66,0x79,0xaa,0x98,0x65,0x46,0x8a,0xaa,0xa9,0x98,0x87,0x66,0x67,0x88,0x99,0xaa,
+0xa8,0x65,0x56,0x77,0x77,0x76,0x66,0x78,0x88,0x88,0x99,0xaa,0x97,0x66,0x67,0x78,
+0x99,0x99,0x87,0x65,0x68,0x99,0x99,0x98,0x88,0x77,0x77,0x77,0x78,0x89,0xaa,0x98,
+0x66,0x67,0x78,0x99,0x87,0x66,0x66,0x66,0x77,0x89,0x9a,0x97,0x65,0x55,0x56,0x68,
+0x9a,0xa9,0x88,0x88,0x88,0x88,0x77,0x77,0x77,0x76,0x55,0x56,0x89,0x99,0x88,0x77,
+0x77,0x77,0x78,0x99,0x88,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x66,0x66,0x79,
+0x9a,0x99,0x88,0x76,0x66,0x77,0x89,0x99,0x99,0x99,0x87,0x55,0x67,0x89,0x98,0x77,
+0x66,0x66,0x78,0x99,0x9a,0xaa,0xaa,0x98,0x65,0x55,0x66,0x77,0x88,0x87,0x76,0x67,
+0x77,0x77,0x88,0x89,0xaa,0x98,0x77,0x78,0x89,0x98,0x87,0x65,0x55,0x55,0x66,0x66,
+0x78,0x9a,0xa9,0x98,0x88,0x98,0x87,0x76,0x66,0x66,0x66,0x77,0x88,0x88,0x88,0x88,
+0x87,0x78,0x99,0xa9,0x98,0x88,0x77,0x77,0x77,0x66,0x78,0x89,0x99,0x99,0x88,0x77,
+0x78,0x88,0x88,0x88,0x88,0x99,0x99,0x87,0x77,0x77,0x88,0x88,0x89,0x99,0x99,0x99,
+0x99,0x98,0x88,0x77,0x77,0x88,0x89,0x99,0x88,0x77,0x77,0x78,0x88,0x88,0x88,0x88,
+0x88,0x88,0x87,0x77,0x77,0x88,0x99,0x98,0x87,0x77,0x77,0x77,0x77,0x77,0x78,0x99,
+0x99,0x99,0x99,0x99,0x98,0x77,0x66,0x66,0x66,0x66,0x66,0x67,0x78,0x9a,0xaa,0xaa,
+0xaa,0x98,0x87,0x66,0x55,0x56,0x66,0x66,0x77,0x88,0x88,0x88,0x88,0x88,0x89,0x99,
+0x99,0x88,0x88,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x78,0x99,0xaa,0xa9,
+0x98,0x88,0x77,0x76,0x66,0x66,0x67,0x88,0x88,0x88,0x88,0x88,0x87,0x77,0x76,0x66,
+0x66,0x66,0x66,0x67,0x88,0x99,0x99,0x99,0x87,0x76,0x66,0x66,0x77,0x77,0x77,0x88,
+0x88,0x87,0x77,0x77,0x78,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x89,0x99,0x99,0x98,
+0x88,0x88,0x88,0x88,0x87,0x76,0x66,0x66,0x66,0x77,0x78,0x99,0xaa,0xaa,0x99,0x99,
+0x99,0x99,0x88,0x87,0x77,0x77,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x88,0x99,0x99,
+0x99,0x88,0x77,0x76,0x66,0x66,0x67,0x77,0x88,0x88,0x88,0x87,0x78,0x88,0x88,0x77,
+0x77,0x66,0x66,0x66,0x66,0x66,0x66,0x77,0x77,0x78,0x88,0x88,0x99,0x99,0x88,0x77,
+0x76,0x66,0x66,0x67,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x99,0x98,0x88,0x87,0x77,
+0x76,0x66,0x66,0x66,0x66,0x77,0x77,0x88,0x88,0x88,0x99,0x99,0x88,0x88,0x88,0x87,
+0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x89,0x99,0x99,0x98,0x88,0x88,0x77,0x77,
+0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x87,0x77,0x77,0x77,0x77,
+0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x77,0x77,0x77,0x77,0x77,0x77,0x77,
+0x77,0x78,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x77,0x77,0x77,0x77,0x77,
+0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x87,0x77,0x77,0x77,
+0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+0x88,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x78,0x88,0x88,0x88,0x88,0x88,0x88,
+0x88,0x87,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,0x88,0x88,
+0x88,0x88,0x88,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x88,0x88,0x88,0x88,
+0x88,0x88,0x88,0x88,0x88,0x88,0x77,0x77,0x78,0x88,0x88,0x88,0x88,0x88,0x88,0x87,
+0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x78,0x88,0x88,0x88,
+0x88,0x88,0x88,0x87,0x78,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,
+};
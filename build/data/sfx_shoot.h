@@ -0,0 +1,11 @@
+//AUTOGENERATED FILE FROM cvtsample
+#ifndef WAVE_SOUND_sfx_shoot_H
+#define WAVE_SOUND_sfx_shoot_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define sfx_shoot_SIZE 0x470
+extern const uint8_t sfx_shoot[];
+
+BANKREF_EXTERN(sfx_shoot)
+#endif
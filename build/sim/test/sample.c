@@ -0,0 +1,246 @@
+/*
+ * sample.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * Based on examples from gbdk-2020:
+ * https://github.com/gbdk-2020/gbdk-2020/tree/develop/gbdk-lib/examples/gb/wav_sample
+ *
+ * And the docs for the DMG APU:
+ * https://gbdev.io/pandocs/Audio_Registers.html
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "banks.h"
+#include "config.h"
+#include "gb/hardware.h"
+#include "sfx_shoot.h"
+#include "sfx_expl_orb.h"
+#include "sfx_expl_ship.h"
+#include "sfx_damage.h"
+#include "sfx_heal.h"
+#include "sample.h"
+
+BANKREF(sample)
+
+// wave channel period for 32 samples, 2048 - (65536 * 32 / SAMPLE_RATE)
+#if SAMPLE_RATE == 8192
+#define SAMPLE_FREQ_LO 0x00
+#elif SAMPLE_RATE == 16384
+#define SAMPLE_FREQ_LO 0x80
+#else
+#error "SAMPLE_RATE needs to be 8192 or 16384"
+#endif
+#define SAMPLE_FREQ_HI 0x07
+
+#define SAMPLE_QUEUE_LEN 4
+
+enum SFX_FLAGS {
+    SFX_RETRIGGER = (1 << 0), // restarts itself while playing
+    SFX_EDGE      = (1 << 1), // only when not requested in the previous frame
+};
+
+// played on a tone channel instead, when channel 3 is busy
+struct sfx_tone {
+    uint8_t noise; // channel 4 instead of 2
+    uint8_t len;   // NRx1
+    uint8_t env;   // NRx2
+    uint16_t freq; // NR23 and NR24, or NR43 for noise
+};
+
+struct sfx_queued {
+    enum SFXS sfx;
+    uint8_t ttl; // frames left to wait for channel 3, 0 when free
+};
+
+static enum SFXS play_sfx = SFX_COUNT;
+static uint8_t play_bank = 1;
+static const uint8_t *play_sample = 0;
+static uint16_t play_length = 0;
+static uint8_t play_ticks = 0;
+
+static struct sfx_queued queue[SAMPLE_QUEUE_LEN];
+static uint8_t held = 0;
+static uint8_t held_prev = 0;
+
+struct sfxs {
+    uint8_t bank;
+    uint8_t * const smp;
+    uint16_t len;
+    uint8_t prio; // higher cuts off lower, equal ones wait
+    uint8_t ttl; // frames to wait in the queue, 0 to drop instead
+    uint8_t flags;
+    const struct sfx_tone *tone; // NULL to queue or drop instead
+};
+
+static const struct sfx_tone tone_shot = {
+    .noise = 0, .len = 0xB0, .env = 0x91, .freq = 1750, // 50% duty, short, fading
+};
+
+static const struct sfx_tone tone_expl_orb = {
+    .noise = 1, .len = 0x20, .env = 0xA2, .freq = 0x55, // medium length, fading
+};
+
+static const struct sfxs sfxs[SFX_COUNT] = {
+    { .bank = BANK(sfx_shoot),     .smp = sfx_shoot,     .len = sfx_shoot_SIZE >> 4,     // SFX_SHOT
+      .prio = 0, .ttl = 0,  .flags = SFX_RETRIGGER, .tone = &tone_shot },
+    { .bank = BANK(sfx_expl_orb),  .smp = sfx_expl_orb,  .len = sfx_expl_orb_SIZE >> 4,  // SFX_EXPL_ORB
+      .prio = 1, .ttl = 8,  .flags = 0,             .tone = &tone_expl_orb },
+    { .bank = BANK(sfx_expl_ship), .smp = sfx_expl_ship, .len = sfx_expl_ship_SIZE >> 4, // SFX_EXPL_SHIP
+      .prio = 3, .ttl = 30, .flags = 0,             .tone = NULL },
+    { .bank = BANK(sfx_damage),    .smp = sfx_damage,    .len = sfx_damage_SIZE >> 4,    // SFX_DAMAGE
+      .prio = 2, .ttl = 15, .flags = SFX_EDGE,      .tone = NULL },
+    { .bank = BANK(sfx_heal),      .smp = sfx_heal,      .len = sfx_heal_SIZE >> 4,      // SFX_HEAL
+      .prio = 2, .ttl = 15, .flags = SFX_EDGE,      .tone = NULL },
+};
+
+static void sample_start(enum SFXS sfx) {
+    CRITICAL {
+        play_sfx = sfx;
+        play_bank = sfxs[sfx].bank;
+        play_sample = sfxs[sfx].smp;
+        play_length = sfxs[sfx].len;
+    }
+}
+
+static void sample_tone(const struct sfx_tone *t) {
+    // the music takes the channel back with its next note
+    if (t->noise) {
+        NR41_REG = t->len;
+        NR42_REG = t->env;
+        NR43_REG = t->freq;
+        NR44_REG = 0xC0; // trigger and enable length
+    } else {
+        NR21_REG = t->len;
+        NR22_REG = t->env;
+        NR23_REG = t->freq & 0xFF;
+        NR24_REG = 0x80 | 0x40 | ((t->freq >> 8) & 0x07); // trigger, enable length, upper freq bits
+    }
+}
+
+static void sample_queue(enum SFXS sfx) {
+    uint8_t slot = SAMPLE_QUEUE_LEN;
+
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if (queue[i].ttl == 0) {
+            slot = i;
+        } else if (queue[i].sfx == sfx) {
+            slot = i;
+            break;
+        } else if ((slot == SAMPLE_QUEUE_LEN) && (sfxs[queue[i].sfx].prio < sfxs[sfx].prio)) {
+            // full so far, replace something less important
+            slot = i;
+        }
+    }
+
+    if (slot < SAMPLE_QUEUE_LEN) {
+        queue[slot].sfx = sfx;
+        queue[slot].ttl = sfxs[sfx].ttl;
+    }
+}
+
+void sample_play(enum SFXS sfx) HOT {
+    if (sfx >= SFX_COUNT) {
+        return;
+    }
+
+    /*
+    if (conf_get()->sfx_vol == 0) {
+        return;
+    }
+    */
+
+    if (sfxs[sfx].flags & SFX_EDGE) {
+        uint8_t bit = 1 << sfx;
+        held |= bit;
+        if (held_prev & bit) {
+            return;
+        }
+    }
+
+    if ((play_length == 0) || (sfxs[sfx].prio > sfxs[play_sfx].prio)) {
+        sample_start(sfx);
+    } else if ((sfx == play_sfx) && (sfxs[sfx].flags & SFX_RETRIGGER)) {
+        sample_start(sfx);
+    } else if (sfxs[sfx].tone) {
+        sample_tone(sfxs[sfx].tone);
+    } else if ((sfx != play_sfx) && (sfxs[sfx].ttl > 0)) {
+        // a repeat of the playing one would only sound twice
+        sample_queue(sfx);
+    }
+}
+
+void sample_update(void) HOT {
+    uint8_t next = SAMPLE_QUEUE_LEN;
+
+    held_prev = held;
+    held = 0;
+
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if (queue[i].ttl == 0) {
+            continue;
+        }
+
+        queue[i].ttl--;
+        if ((next == SAMPLE_QUEUE_LEN) || (sfxs[queue[i].sfx].prio > sfxs[queue[next].sfx].prio)) {
+            next = i;
+        }
+    }
+
+    if ((next < SAMPLE_QUEUE_LEN) && (play_length == 0)) {
+        sample_start(queue[next].sfx);
+        queue[next].ttl = 0;
+    }
+}
+
+// keeps the effect that is playing, only forgets the requests
+void sample_reset(void) HOT {
+    memset(queue, 0, sizeof(queue));
+    held = 0;
+    held_prev = 0;
+}
+
+uint8_t sample_running(void) HOT {
+    return (play_length > 0) ? 1 : 0;
+}
+
+void sample_play_banked(enum SFXS sfx) BANKED {
+    sample_play(sfx);
+}
+
+uint8_t sample_running_banked(void) BANKED {
+    return sample_running();
+}
+
+uint8_t sample_ticks(void) NONBANKED {
+    uint8_t r;
+    CRITICAL {
+        r = play_ticks;
+        play_ticks = 0;
+    }
+    return r;
+}
+
+/*
+ * Wave RAM can only be written with channel 3 stopped, so it is
+ * muted in NR51 and its DAC is off for the 16 copies. That gap
+ * is what makes the 'beep' at the interrupt rate, so the copy is
+ * unrolled to keep it at 82 M-cycles.
+ *
+ * Cycle counts are in the comments, in M-cycles. A tick loading
+ * the next 32 samples takes SAMPLE_ISR_CYCLES, an idle one 12.
+ */
@@ -0,0 +1,21 @@
+//AUTOGENERATED FILE FROM util/gen_gravity.py
+#ifndef GEN_CONST_GRAVITY_table_gravity_H
+#define GEN_CONST_GRAVITY_table_gravity_H
+#include <stdint.h>
+
+#define table_gravity_SCALE 5
+#define table_gravity_RANGE 768
+#define table_gravity_QUANT 8
+#define table_gravity_SIZE 7
+
+// static so it ends up in the bank of the one file including it
+static const int8_t table_gravity[table_gravity_SIZE] = {
+    -1, // -768 to -513
+    -1, // -512 to -257
+    -2, // -256 to -1
+    1, // 0 to 255
+    0, // 256 to 511
+    0, // 512 to 767
+    0, // 768 to 768
+};
+#endif
@@ -0,0 +1,23 @@
+//AUTOGENERATED FILE FROM util/gen_angles.py
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "table_speed_move.h"
+BANKREF(table_speed_move)
+const int8_t table_speed_move[table_speed_move_SIZE] = {
+    0, 23, // 0.0
+    9, 21, // 22.5
+    16, 16, // 45.0
+    21, 9, // 67.5
+    23, 0, // 90.0
+    21, -9, // 112.5
+    16, -16, // 135.0
+    9, -21, // 157.5
+    0, -23, // 180.0
+    -9, -21, // 202.5
+    -16, -16, // 225.0
+    -21, -9, // 247.5
+    -23, 0, // 270.0
+    -21, 9, // 292.5
+    -16, 16, // 315.0
+    -9, 21, // 337.5
+};
@@ -0,0 +1,12 @@
+//AUTOGENERATED FILE FROM util/gen_angles.py
+#ifndef GEN_CONST_ANGLES_table_speed_move_H
+#define GEN_CONST_ANGLES_table_speed_move_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define table_speed_move_WIDTH 2
+#define table_speed_move_SIZE 32
+extern const int8_t table_speed_move[table_speed_move_SIZE];
+
+BANKREF_EXTERN(table_speed_move)
+#endif
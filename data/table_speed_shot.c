@@ -0,0 +1,23 @@
+//AUTOGENERATED FILE FROM util/gen_angles.py
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "table_speed_shot.h"
+BANKREF(table_speed_shot)
+const int8_t table_speed_shot[table_speed_shot_SIZE] = {
+    0, 42, // 0.0
+    16, 39, // 22.5
+    30, 30, // 45.0
+    39, 16, // 67.5
+    42, 0, // 90.0
+    39, -16, // 112.5
+    30, -30, // 135.0
+    16, -39, // 157.5
+    0, -42, // 180.0
+    -16, -39, // 202.5
+    -30, -30, // 225.0
+    -39, -16, // 247.5
+    -42, 0, // 270.0
+    -39, 16, // 292.5
+    -30, 30, // 315.0
+    -16, 39, // 337.5
+};
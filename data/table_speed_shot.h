@@ -0,0 +1,12 @@
+//AUTOGENERATED FILE FROM util/gen_angles.py
+#ifndef GEN_CONST_ANGLES_table_speed_shot_H
+#define GEN_CONST_ANGLES_table_speed_shot_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+
+#define table_speed_shot_WIDTH 2
+#define table_speed_shot_SIZE 32
+extern const int8_t table_speed_shot[table_speed_shot_SIZE];
+
+BANKREF_EXTERN(table_speed_shot)
+#endif
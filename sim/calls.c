@@ -0,0 +1,112 @@
+/*
+ * calls.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Counts calls to BANKED functions, which on the Game Boy
+ * all go through the banked call trampoline. Built with
+ * -finstrument-functions, every call is counted, the report
+ * then only lists the functions named in $SIM_BANKED.
+ * The Makefile collects those from the headers.
+ */
+
+#ifdef SIM_CALLS
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+
+#define MAX_FUNCS 512
+
+#define NO_TRACE __attribute__((no_instrument_function))
+
+struct call_count {
+    void *fn;
+    uint32_t count;
+};
+
+static struct call_count calls[MAX_FUNCS];
+static size_t calls_len = 0;
+
+NO_TRACE void __cyg_profile_func_enter(void *fn, void *caller) {
+    (void)caller;
+
+    for (size_t i = 0; i < calls_len; i++) {
+        if (calls[i].fn == fn) {
+            calls[i].count++;
+            return;
+        }
+    }
+
+    if (calls_len < MAX_FUNCS) {
+        calls[calls_len].fn = fn;
+        calls[calls_len].count = 1;
+        calls_len++;
+    }
+}
+
+NO_TRACE void __cyg_profile_func_exit(void *fn, void *caller) {
+    (void)fn;
+    (void)caller;
+}
+
+NO_TRACE static int cmp_calls(const void *a, const void *b) {
+    const struct call_count *ca = a;
+    const struct call_count *cb = b;
+    return (ca->count < cb->count) - (ca->count > cb->count);
+}
+
+// name as a whole word in the space separated list
+NO_TRACE static int is_banked(const char *list, const char *name) {
+    size_t len = strlen(name);
+    for (const char *s = strstr(list, name); s; s = strstr(s + 1, name)) {
+        if (((s == list) || (s[-1] == ' ')) && ((s[len] == ' ') || (s[len] == '\0'))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+NO_TRACE void sim_calls_report(uint32_t frames) {
+    const char *list = getenv("SIM_BANKED");
+    if (!list) {
+        list = "";
+    }
+
+    qsort(calls, calls_len, sizeof(calls[0]), cmp_calls);
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < calls_len; i++) {
+        Dl_info info;
+        if ((!dladdr(calls[i].fn, &info)) || (!info.dli_sname)
+                || (!is_banked(list, info.dli_sname))) {
+            continue;
+        }
+
+        printf("%10.3f  %s\n", (double)calls[i].count / frames, info.dli_sname);
+        total += calls[i].count;
+    }
+
+    printf("%10.3f  banked calls per frame\n", (double)total / frames);
+}
+
+#endif // SIM_CALLS
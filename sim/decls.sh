@@ -0,0 +1,6 @@
+#!/bin/sh
+# Prints the names of the functions declared with
+# qualifier $1 in the headers given after it.
+q="$1"
+shift
+cat "$@" | tr '\n' ' ' | grep -o "[A-Za-z0-9_]*([^;{}()]*) *$q *;" | sed 's/(.*//'
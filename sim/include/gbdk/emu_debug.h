@@ -1,5 +1,5 @@
 /*
- * sound_over.h
+ * emu_debug.h
  * Duality
  *
  * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
@@ -17,13 +17,11 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __SOUND_OVER_H__
-#define __SOUND_OVER_H__
+#ifndef __SIM_EMU_DEBUG_H__
+#define __SIM_EMU_DEBUG_H__
 
-#include "sound.h"
+#include <stdio.h>
 
-extern const struct music music_over;
+#define EMU_printf printf
 
-BANKREF_EXTERN(sound_over)
-
-#endif // __SOUND_OVER_H__
+#endif // __SIM_EMU_DEBUG_H__
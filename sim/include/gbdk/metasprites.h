@@ -1,5 +1,5 @@
 /*
- * sound_menu.h
+ * metasprites.h
  * Duality
  *
  * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
@@ -17,13 +17,9 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __SOUND_MENU_H__
-#define __SOUND_MENU_H__
+#ifndef __SIM_METASPRITES_H__
+#define __SIM_METASPRITES_H__
 
-#include "sound.h"
+#include <gbdk/platform.h>
 
-extern const struct music music_menu;
-
-BANKREF_EXTERN(sound_menu)
-
-#endif // __SOUND_MENU_H__
+#endif // __SIM_METASPRITES_H__
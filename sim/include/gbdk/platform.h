@@ -0,0 +1,96 @@
+/*
+ * platform.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Minimal stand-in for the GBDK platform header, just enough
+ * to compile the game logic natively for the host simulation.
+ */
+
+#ifndef __SIM_PLATFORM_H__
+#define __SIM_PLATFORM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BANKED
+#define NONBANKED
+#define NAKED
+#define CRITICAL
+
+#define BANKREF(x) const uint8_t __bank_##x = 1;
+#define BANKREF_EXTERN(x) extern const uint8_t __bank_##x;
+#define BANK(x) (__bank_##x)
+
+extern uint8_t _current_bank;
+#define CURRENT_BANK _current_bank
+#define SWITCH_ROM(x) (_current_bank = (x))
+
+#define ENABLE_RAM
+#define SWITCH_RAM(x)
+
+#define DMG_TYPE 0x01
+#define CGB_TYPE 0x11
+extern uint8_t _cpu;
+
+extern volatile uint8_t sim_regs[0x100];
+#define DIV_REG sim_regs[0x04]
+#define LY_REG  sim_regs[0x44]
+#define BGP_REG sim_regs[0x47]
+#define VBK_REG sim_regs[0x4F]
+
+#define J_RIGHT  0x01U
+#define J_LEFT   0x02U
+#define J_UP     0x04U
+#define J_DOWN   0x08U
+#define J_A      0x10U
+#define J_B      0x20U
+#define J_SELECT 0x40U
+#define J_START  0x80U
+
+#define DEVICE_SCREEN_WIDTH 20
+#define DEVICE_SCREEN_HEIGHT 18
+#define DEVICE_SCREEN_PX_WIDTH (DEVICE_SCREEN_WIDTH * 8)
+#define DEVICE_SCREEN_PX_HEIGHT (DEVICE_SCREEN_HEIGHT * 8)
+#define DEVICE_SPRITE_PX_OFFSET_X 8
+#define DEVICE_SPRITE_PX_OFFSET_Y 16
+#define MINWNDPOSX 7
+#define MINWNDPOSY 0
+#define MAX_HARDWARE_SPRITES 40
+
+typedef uint16_t palette_color_t;
+
+#define DISPLAY_ON
+#define DISPLAY_OFF
+#define SHOW_BKG
+#define SHOW_WIN
+#define HIDE_WIN
+#define SHOW_SPRITES
+#define HIDE_SPRITES
+#define SPRITES_8x8
+
+void vsync(void);
+uint8_t joypad(void);
+void enable_interrupts(void);
+void disable_interrupts(void);
+void move_win(uint8_t x, uint8_t y);
+void hide_sprites_range(uint8_t from, uint8_t to);
+
+extern volatile uint16_t sys_time;
+
+#endif // __SIM_PLATFORM_H__
@@ -1,5 +1,5 @@
 /*
- * sound_game.h
+ * rand.h
  * Duality
  *
  * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
@@ -17,13 +17,12 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __SOUND_GAME_H__
-#define __SOUND_GAME_H__
+#ifndef __SIM_RAND_H__
+#define __SIM_RAND_H__
 
-#include "sound.h"
+#include <stdint.h>
 
-extern const struct music music_game;
+void initarand(uint16_t seed);
+uint8_t arand(void);
 
-BANKREF_EXTERN(sound_game)
-
-#endif // __SOUND_GAME_H__
+#endif // __SIM_RAND_H__
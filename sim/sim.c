@@ -0,0 +1,398 @@
+/*
+ * sim.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Headless host build of the game loop.
+ * Runs game() with joypad input replayed from a text file
+ * for a fixed number of frames, then prints the throughput
+ * and a hash of the final game state.
+ *
+ * Replay file format, one entry per line:
+ *
+ *     # comment
+ *     seed 0x1234
+ *     tier 1
+ *     <frames> <keys> [steps]
+ *
+ * Keys are a number or names joined with '+', for example
+ * "30 a+right" holds A and right for 30 frames.
+ * The replay loops when it reaches the end.
+ *
+ * The optional steps, as written by util/rec2sim.py, replace
+ * the fixed steps game_steps() would derive from the timer
+ * for each of these frames, like a replay on the console.
+ *
+ * With -l n every n-th frame takes two vblanks, to
+ * test how the game copes with dropped frames.
+ * With -t the object tier is selected, see obj_set_tier().
+ * Like -s it overrides the value from the replay file.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <rand.h>
+
+#include "config.h"
+#include "game.h"
+#include "obj.h"
+#include "record.h"
+#include "sim.h"
+
+#define MAX_REPLAY 4096
+#define MAX_LINE 256
+#define DEFAULT_FRAMES 100000
+#define DEFAULT_SEED 42
+
+struct replay_entry {
+    uint32_t frames;
+    uint8_t keys;
+    uint8_t steps; // 0 follows the timer
+};
+
+struct key_name {
+    const char *name;
+    uint8_t key;
+};
+
+static const struct key_name key_names[] = {
+    { "none",   0        },
+    { "right",  J_RIGHT  },
+    { "left",   J_LEFT   },
+    { "up",     J_UP     },
+    { "down",   J_DOWN   },
+    { "a",      J_A      },
+    { "b",      J_B      },
+    { "select", J_SELECT },
+    { "start",  J_START  },
+};
+
+// used when no replay file is given
+static const struct replay_entry default_replay[] = {
+    { 60, J_A },
+    { 8,  J_RIGHT },
+    { 1,  J_B },
+    { 30, J_A },
+    { 1,  J_B },
+    { 4,  J_LEFT },
+    { 90, J_A },
+    { 20, 0 },
+    { 1,  J_B },
+    { 1,  0 },
+    { 1,  J_B },
+};
+
+uint32_t sim_frames = 0;
+uint32_t sim_draw_hash = SIM_HASH_INIT;
+uint32_t sim_lag = 0;
+
+static struct replay_entry replay[MAX_REPLAY];
+static size_t replay_len = 0;
+static size_t replay_pos = 0;
+static uint32_t replay_left = 0;
+static uint8_t replay_steps = 0;
+static uint32_t frame_limit = DEFAULT_FRAMES;
+static uint16_t seed = DEFAULT_SEED;
+static unsigned int tier = OBJ_TIER_DMG;
+
+// FNV-1a
+uint32_t sim_hash(uint32_t h, const void *data, size_t len) {
+    const uint8_t *d = data;
+    while (len-- > 0) {
+        h ^= *(d++);
+        h *= 0x01000193UL;
+    }
+    return h;
+}
+
+static uint32_t hash_u16(uint32_t h, uint16_t v) {
+    uint8_t d[2] = { v & 0xFF, v >> 8 };
+    return sim_hash(h, d, sizeof(d));
+}
+
+static uint32_t hash_u32(uint32_t h, uint32_t v) {
+    h = hash_u16(h, v & 0xFFFF);
+    return hash_u16(h, v >> 16);
+}
+
+// the score as a binary number, so the hashes did not change with BCD
+static int32_t bcd_value(const struct bcd *b) {
+    int32_t v = 0;
+    for (int8_t i = BCD_DIGITS - 1; i >= 0; i--) {
+        v = (v * 10) + bcd_digit(b, i);
+    }
+    return (bcd_sign(b) < 0) ? (v - 100000000L) : v;
+}
+
+static uint32_t state_hash(void) {
+    uint32_t h = SIM_HASH_INIT;
+
+    h = hash_u16(h, game_state.spd_x);
+    h = hash_u16(h, game_state.spd_y);
+    h = hash_u16(h, game_state.rot);
+    h = hash_u16(h, game_state.health);
+    h = hash_u16(h, game_state.power);
+    h = hash_u32(h, bcd_value(&game_state.score));
+
+    for (uint8_t i = 0; i < obj_state.live_cnt; i++) {
+        h = hash_u16(h, obj_state.sprite[i]);
+        h = hash_u16(h, obj_state.off_x[i]);
+        h = hash_u16(h, obj_state.off_y[i]);
+        h = hash_u16(h, obj_state.spd_x[i]);
+        h = hash_u16(h, obj_state.spd_y[i]);
+        h = hash_u16(h, obj_state.travel[i]);
+        h = hash_u16(h, obj_state.frame_index[i]);
+    }
+
+    return h;
+}
+
+uint8_t joypad(void) {
+    if (sim_frames >= frame_limit) {
+        // leave game() through the pause menu
+        static const uint8_t exit_keys[] = { 0, J_START, J_SELECT };
+        static uint8_t exit_pos = 0;
+        uint8_t k = exit_keys[exit_pos];
+        if (exit_pos < (sizeof(exit_keys) - 1)) {
+            exit_pos++;
+        }
+        replay_steps = 0;
+        return k;
+    }
+
+    while (replay_left == 0) {
+        replay_pos = (replay_pos + 1) % replay_len;
+        replay_left = replay[replay_pos].frames;
+    }
+
+    replay_left--;
+    replay_steps = replay[replay_pos].steps;
+    return replay[replay_pos].keys;
+}
+
+// only called with rec_mode set, when the replay has steps
+uint8_t rec_steps(uint8_t steps) {
+    return replay_steps ? replay_steps : steps;
+}
+
+static int parse_keys(const char *s, uint8_t *keys) {
+    char buff[MAX_LINE];
+    strncpy(buff, s, sizeof(buff) - 1);
+    buff[sizeof(buff) - 1] = '\0';
+
+    *keys = 0;
+    for (char *tok = strtok(buff, "+"); tok; tok = strtok(NULL, "+")) {
+        char *end;
+        long v = strtol(tok, &end, 0);
+        if ((end != tok) && (*end == '\0')) {
+            *keys |= v;
+            continue;
+        }
+
+        size_t i;
+        for (i = 0; i < (sizeof(key_names) / sizeof(key_names[0])); i++) {
+            if (strcmp(tok, key_names[i].name) == 0) {
+                *keys |= key_names[i].key;
+                break;
+            }
+        }
+        if (i >= (sizeof(key_names) / sizeof(key_names[0]))) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int load_replay(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    char line[MAX_LINE];
+    unsigned int n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        n++;
+
+        char *c = strchr(line, '#');
+        if (c) {
+            *c = '\0';
+        }
+
+        char a[MAX_LINE], b[MAX_LINE];
+        unsigned int steps = 0;
+        int r = sscanf(line, "%255s %255s %u", a, b, &steps);
+        if (r <= 0) {
+            continue;
+        } else if (r < 2) {
+            fprintf(stderr, "%s:%u: expected two or three fields\n", path, n);
+            fclose(f);
+            return -1;
+        }
+
+        if (strcmp(a, "seed") == 0) {
+            seed = strtol(b, NULL, 0);
+            continue;
+        }
+
+        if (strcmp(a, "tier") == 0) {
+            tier = strtoul(b, NULL, 0);
+            if (tier >= OBJ_TIER_COUNT) {
+                fprintf(stderr, "%s:%u: invalid tier %u\n", path, n, tier);
+                fclose(f);
+                return -1;
+            }
+            continue;
+        }
+
+        if (replay_len >= MAX_REPLAY) {
+            fprintf(stderr, "%s:%u: too many entries\n", path, n);
+            fclose(f);
+            return -1;
+        }
+
+        if ((r == 3) && ((steps == 0) || (steps > REC_STEPS_MAX))) {
+            fprintf(stderr, "%s:%u: invalid steps %u\n", path, n, steps);
+            fclose(f);
+            return -1;
+        } else if (r == 3) {
+            rec_mode = REC_REPLAY;
+        }
+
+        replay[replay_len].frames = strtoul(a, NULL, 0);
+        replay[replay_len].steps = steps;
+        if (parse_keys(b, &replay[replay_len].keys) != 0) {
+            fprintf(stderr, "%s:%u: invalid keys '%s'\n", path, n, b);
+            fclose(f);
+            return -1;
+        }
+        replay_len++;
+    }
+
+    fclose(f);
+    return 0;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-n frames] [-r replay] [-s seed] [-d debug_flags] [-l lag_every_n] [-t tier]\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    const char *replay_path = NULL;
+    long seed_arg = -1;
+    enum debug_flag flags = DBG_NONE;
+    long tier_arg = -1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:r:s:d:l:t:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                frame_limit = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'r':
+                replay_path = optarg;
+                break;
+
+            case 's':
+                seed_arg = strtol(optarg, NULL, 0);
+                break;
+
+            case 'd':
+                flags = strtol(optarg, NULL, 0);
+                break;
+
+            case 'l':
+                sim_lag = strtoul(optarg, NULL, 0);
+                break;
+
+            case 't':
+                tier_arg = strtol(optarg, NULL, 0);
+                if ((tier_arg < 0) || (tier_arg >= OBJ_TIER_COUNT)) {
+                    fprintf(stderr, "invalid tier %ld\n", tier_arg);
+                    return 1;
+                }
+                break;
+
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (replay_path) {
+        if (load_replay(replay_path) != 0) {
+            return 1;
+        }
+    } else {
+        replay_len = sizeof(default_replay) / sizeof(default_replay[0]);
+        memcpy(replay, default_replay, sizeof(default_replay));
+    }
+
+    if (replay_len == 0) {
+        fprintf(stderr, "replay is empty\n");
+        return 1;
+    }
+    replay_pos = 0;
+    replay_left = replay[0].frames;
+
+    if (seed_arg >= 0) {
+        seed = seed_arg;
+    }
+    if (tier_arg >= 0) {
+        tier = tier_arg;
+    }
+
+    mem.config.debug_flags = flags;
+    obj_set_tier(tier);
+    prng_seed = seed;
+    initarand(prng_seed);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    uint32_t games = 0;
+    while (sim_frames < frame_limit) {
+        game_init();
+        game(GM_SINGLE);
+        games++;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double secs = (end.tv_sec - start.tv_sec) + ((end.tv_nsec - start.tv_nsec) / 1e9);
+
+    printf("frames:     %u\n", sim_frames);
+    printf("games:      %u\n", games);
+    printf("seed:       0x%04X\n", seed);
+    printf("tier:       %u\n", tier);
+    printf("time:       %.3f s\n", secs);
+    printf("frames/s:   %.0f\n", (secs > 0.0) ? (sim_frames / secs) : 0.0);
+    printf("state hash: 0x%08X\n", state_hash());
+    printf("draw hash:  0x%08X\n", sim_draw_hash);
+
+#ifdef SIM_CALLS
+    sim_calls_report(sim_frames);
+#endif
+
+    return 0;
+}
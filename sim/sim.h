@@ -0,0 +1,38 @@
+/*
+ * sim.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SIM_H__
+#define __SIM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SIM_HASH_INIT 0x811C9DC5UL
+
+extern uint32_t sim_frames;
+extern uint32_t sim_draw_hash;
+extern uint32_t sim_lag;
+
+uint32_t sim_hash(uint32_t h, const void *data, size_t len);
+
+#ifdef SIM_CALLS
+void sim_calls_report(uint32_t frames);
+#endif
+
+#endif // __SIM_H__
@@ -0,0 +1,161 @@
+/*
+ * stubs.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host replacements for the GBDK library and for all the
+ * modules the game logic calls that touch the hardware.
+ * Sprite draw calls are folded into a hash, so rendering
+ * changes show up in the simulation output as well.
+ */
+
+#include <gbdk/platform.h>
+#include <rand.h>
+
+#include "config.h"
+#include "maps.h"
+#include "sprites.h"
+#include "sound.h"
+#include "sample.h"
+#include "vram.h"
+#include "window.h"
+#include "text.h"
+#include "multiplayer.h"
+#include "timer.h"
+#include "record.h"
+#include "sim.h"
+
+// LCD refresh rate in 1/10000 Hz
+#define SIM_FPS 597275ULL
+
+uint8_t _current_bank = 1;
+uint8_t _cpu = DMG_TYPE;
+volatile uint8_t sim_regs[0x100];
+volatile uint16_t sys_time = 0;
+
+struct config_mem mem;
+uint16_t prng_seed;
+
+static uint16_t rand_state = 1;
+
+// ----------------------------------------------------------------------------
+// GBDK
+// ----------------------------------------------------------------------------
+
+void vsync(void) {
+    static uint32_t n = 0;
+
+    // pretend every sim_lag-th frame missed a vblank
+    uint8_t vbls = ((sim_lag > 0) && ((++n % sim_lag) == 0)) ? 2 : 1;
+    sim_frames += vbls;
+    sys_time += vbls;
+}
+
+void enable_interrupts(void) { }
+void disable_interrupts(void) { }
+void move_win(uint8_t x, uint8_t y) { }
+void hide_sprites_range(uint8_t from, uint8_t to) { }
+
+// not the GBDK algorithm, but just as deterministic
+void initarand(uint16_t seed) {
+    rand_state = seed ? seed : 1;
+}
+
+uint8_t arand(void) {
+    rand_state ^= rand_state << 7;
+    rand_state ^= rand_state >> 9;
+    rand_state ^= rand_state << 8;
+    return rand_state >> 8;
+}
+
+// ----------------------------------------------------------------------------
+// Duality
+// ----------------------------------------------------------------------------
+
+void spr_init_pal(void) { }
+
+void spr_draw(enum SPRITES sprite, enum SPRITE_FLIP flip,
+              int8_t x_off, int8_t y_off, uint8_t frame,
+              uint8_t *hiwater) {
+    uint8_t d[5] = { sprite, flip, x_off, y_off, frame };
+    sim_draw_hash = sim_hash(sim_draw_hash, d, sizeof(d));
+    (*hiwater)++;
+}
+
+void spr_sched_begin(void) { }
+void spr_sched_end(uint8_t *hiwater) { }
+void spr_oam_begin(void) { }
+void spr_oam_commit(void) { }
+void spr_oam_reset(void) { }
+
+void spr_ship(enum SPRITE_ROT rot, uint8_t moving, int8_t x_off, int8_t y_off, uint8_t *hiwater) {
+    spr_draw(SPR_SHIP, FLIP_NONE, x_off, y_off, (rot << 1) | (moving ? 1 : 0), hiwater);
+}
+
+void map_load(uint8_t is_splash) BANKED { }
+
+static struct map_job job;
+struct map_job *map_load_begin(uint8_t is_splash) BANKED { return &job; }
+uint8_t map_load_step(struct map_job *j) BANKED { return 0; }
+void map_load_show(struct map_job *j) BANKED { }
+void map_fill(enum MAPS map, uint8_t bkg) { }
+void map_game(enum MAPS map) BANKED { }
+void map_move(int16_t delta_x, int16_t delta_y) { }
+void map_dbg_reset(void) { }
+
+void snd_music_off(void) BANKED { }
+void snd_note_off(void) BANKED { }
+void snd_music(enum SOUNDS snd) BANKED { }
+
+void sample_play(enum SFXS sfx) HOT { }
+void sample_update(void) HOT { }
+void sample_reset(void) HOT { }
+
+uint8_t sample_running(void) HOT {
+    return 0;
+}
+
+uint8_t sample_ticks(void) {
+    return 0;
+}
+
+uint8_t win_game_draw(const struct bcd *score, uint8_t initial) BANKED {
+    return 0;
+}
+
+uint8_t number_cached_pending(void) BANKED {
+    return 0;
+}
+
+uint8_t vram_move_win(uint8_t x, uint8_t y) { return 1; }
+void vram_flush(void) { }
+
+uint8_t mp_handle(void) BANKED { return 1; }
+void mp_new_state(struct mp_player_state *state) BANKED { }
+void mp_add_shot(struct mp_shot_state *state) BANKED { }
+uint8_t mp_is_master = 0;
+
+// the replay comes from the file instead, rec_steps() is in sim.c
+enum REC_MODE rec_mode = REC_OFF;
+uint8_t rec_key(uint8_t keys) { return keys; }
+
+// same 256Hz resolution as the real timer
+uint16_t timer_get(void) {
+    uint16_t count = (sim_frames * 256ULL * 10000ULL) / SIM_FPS;
+    return count << 2;
+}
@@ -0,0 +1,48 @@
+/*
+ * gb/hardware.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Stand-in for the GBDK hardware header in sim/test. Maps the
+ * sound registers onto sim_regs, at their offsets in the 0xFF00
+ * page, so the tests can read back what was written.
+ */
+
+#ifndef __SIM_HARDWARE_H__
+#define __SIM_HARDWARE_H__
+
+#include <gbdk/platform.h>
+
+#define NR10_REG sim_regs[0x10]
+#define NR11_REG sim_regs[0x11]
+#define NR12_REG sim_regs[0x12]
+#define NR13_REG sim_regs[0x13]
+#define NR14_REG sim_regs[0x14]
+#define NR21_REG sim_regs[0x16]
+#define NR22_REG sim_regs[0x17]
+#define NR23_REG sim_regs[0x18]
+#define NR24_REG sim_regs[0x19]
+#define NR41_REG sim_regs[0x20]
+#define NR42_REG sim_regs[0x21]
+#define NR43_REG sim_regs[0x22]
+#define NR44_REG sim_regs[0x23]
+#define NR50_REG sim_regs[0x24]
+#define NR51_REG sim_regs[0x25]
+#define NR52_REG sim_regs[0x26]
+
+#endif // __SIM_HARDWARE_H__
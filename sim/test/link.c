@@ -0,0 +1,288 @@
+/*
+ * link.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs both ends of the link cable protocol in src/multiplayer.c
+ * against each other, on a simulated wire. Time is counted in
+ * M-cycles at normal speed. The master clocks one byte per
+ * timer tick, the slave handler runs after a random delay of
+ * up to -l cycles and a byte is only exchanged if the slave
+ * is ready again when the master starts it. With -e one in
+ * that many bytes gets a bit flipped on the wire.
+ *
+ * Checks that player states keep arriving, fresh enough, and
+ * that every shot arrives exactly once and in order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "link.h"
+#include "game.h"
+#include "timer.h"
+#include "multiplayer.h"
+
+#define CPU_HZ 1048576UL
+#define FRAME_CYCLES 17556UL
+#define TICK_CYCLES (CPU_HZ / 256)
+#define BYTE_CYCLES (8 * (CPU_HZ / 8192))
+
+#define MIN_STATES_PER_S 18
+#define MAX_STATE_AGE 12 // frames
+#define SHOT_EVERY 16 // frames, on average
+
+struct side {
+    const char *name;
+    uint8_t (*handle)(void);
+    void (*new_state)(struct mp_player_state *state);
+    void (*add_shot)(struct mp_shot_state *state);
+
+    uint8_t frame;
+    uint32_t states;
+    uint32_t max_age;
+    uint8_t shots_sent;
+    uint8_t shots_rcvd;
+    uint32_t shots_added;
+    uint32_t shots_total;
+    uint32_t errors;
+};
+
+struct link_side a_link, b_link;
+
+uint8_t a_mp_handle(void);
+void a_mp_new_state(struct mp_player_state *state);
+void a_mp_add_shot(struct mp_shot_state *state);
+void a_mp_master_start(void);
+uint8_t b_mp_handle(void);
+void b_mp_new_state(struct mp_player_state *state);
+void b_mp_add_shot(struct mp_shot_state *state);
+void b_mp_slave_start(void);
+
+static struct side sides[2] = {
+    { .name = "master", .handle = a_mp_handle, .new_state = a_mp_new_state, .add_shot = a_mp_add_shot },
+    { .name = "slave",  .handle = b_mp_handle, .new_state = b_mp_new_state, .add_shot = b_mp_add_shot },
+};
+
+static uint64_t now = 0;
+static uint32_t frames = 3000;
+static uint32_t latency = 2500;
+static uint32_t error_rate = 0;
+static uint32_t lost_bytes = 0;
+static uint8_t link_down = 0;
+
+uint16_t timer_get(void) {
+    return (now * TIMER_HZ) / CPU_HZ;
+}
+
+static void got_state(struct side *s, struct mp_player_state *state) {
+    // the other side puts its frame counter in pos_x
+    struct side *o = (s == &sides[0]) ? &sides[1] : &sides[0];
+    uint8_t age = o->frame - state->pos_x;
+    if (age > s->max_age) {
+        s->max_age = age;
+    }
+    s->states++;
+}
+
+static void got_shot(struct side *s, struct mp_shot_state *state) {
+    if (state->pos_x != (uint8_t)(s->shots_rcvd + 1)) {
+        printf("%s: shot %u after %u\n", s->name, state->pos_x, s->shots_rcvd);
+        s->errors++;
+    }
+    s->shots_rcvd = state->pos_x;
+    s->shots_total++;
+}
+
+void a_game_set_mp_player2(struct mp_player_state *state) { got_state(&sides[0], state); }
+void a_game_set_mp_shot(struct mp_shot_state *state) { got_shot(&sides[0], state); }
+void b_game_set_mp_player2(struct mp_player_state *state) { got_state(&sides[1], state); }
+void b_game_set_mp_shot(struct mp_shot_state *state) { got_shot(&sides[1], state); }
+
+void a_game_init(void) { }
+void b_game_init(void) { }
+
+static uint8_t wire(uint8_t b) {
+    if (error_rate && ((rand() % error_rate) == 0)) {
+        b ^= 1 << (rand() % 8);
+    }
+    return b;
+}
+
+static void main_loop(struct side *s) {
+    if (!s->handle()) {
+        link_down = 1;
+    }
+
+    struct mp_player_state state = { .pos_x = s->frame, .health = 1 };
+    s->new_state(&state);
+
+    if ((rand() % SHOT_EVERY) == 0) {
+        struct mp_shot_state shot = { .pos_x = ++s->shots_sent };
+        s->shots_added++;
+        s->add_shot(&shot);
+    }
+
+    s->frame++;
+}
+
+// both ends are set up now, run the simulation from here
+uint8_t b_game(enum GAME_MODE mode) {
+    uint64_t end = frames * FRAME_CYCLES;
+    uint64_t next_frame[2] = { 0, FRAME_CYCLES / 3 };
+    uint64_t next_tick = 0;
+    uint64_t xfer_done = 0;
+    uint64_t slave_isr = 0;
+    uint8_t slave_pending = 0;
+    uint8_t slave_xfer = 0;
+
+    while (now < end) {
+        // next event
+        uint64_t t = next_tick;
+        for (uint8_t i = 0; i < 2; i++) {
+            if (next_frame[i] < t) {
+                t = next_frame[i];
+            }
+        }
+        if (xfer_done && (xfer_done < t)) {
+            t = xfer_done;
+        }
+        if (slave_pending && (slave_isr < t)) {
+            t = slave_isr;
+        }
+        now = t;
+
+        if (xfer_done && (now == xfer_done)) {
+            xfer_done = 0;
+
+            uint8_t m = a_link.sb;
+            uint8_t s = b_link.sb;
+            a_link.sb = slave_xfer ? wire(s) : 0xFF;
+            a_link.sc &= ~SIOF_XFER_START;
+            if (a_link.sio) {
+                a_link.sio();
+            }
+
+            if (slave_xfer) {
+                b_link.sb = wire(m);
+                b_link.sc &= ~SIOF_XFER_START;
+                slave_pending = 1;
+                slave_isr = now + (latency ? (rand() % latency) : 0);
+            } else {
+                lost_bytes++;
+            }
+        } else if (slave_pending && (now == slave_isr)) {
+            slave_pending = 0;
+            if (b_link.sio) {
+                b_link.sio();
+            }
+        } else if (now == next_tick) {
+            next_tick += TICK_CYCLES;
+            if (a_link.tim) {
+                a_link.tim();
+            }
+
+            if ((a_link.sc & SIOF_XFER_START) && !xfer_done) {
+                xfer_done = now + BYTE_CYCLES;
+                slave_xfer = (b_link.sc & SIOF_XFER_START) != 0;
+            }
+        } else {
+            for (uint8_t i = 0; i < 2; i++) {
+                if (now == next_frame[i]) {
+                    next_frame[i] += FRAME_CYCLES;
+                    main_loop(&sides[i]);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+uint8_t a_game(enum GAME_MODE mode) {
+    b_mp_slave_start();
+    return 0;
+}
+
+static void usage(const char *name) {
+    printf("usage: %s [-n frames] [-l latency] [-e error rate] [-s seed]\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    unsigned int seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:l:e:s:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                frames = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'l':
+                latency = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'e':
+                error_rate = strtoul(optarg, NULL, 0);
+                break;
+
+            case 's':
+                seed = strtoul(optarg, NULL, 0);
+                break;
+
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    srand(seed);
+
+    a_mp_master_start();
+
+    int r = 0;
+    double secs = (double)frames * FRAME_CYCLES / CPU_HZ;
+    printf("%u frames, latency %u, error rate %u, %u bytes missed by the slave\n",
+           frames, latency, error_rate, lost_bytes);
+
+    for (uint8_t i = 0; i < 2; i++) {
+        struct side *s = &sides[i];
+        double rate = s->states / secs;
+        printf("%-6s: %.1f states/s, max age %u frames, %u/%u shots\n",
+               s->name, rate, s->max_age, s->shots_total, sides[1 - i].shots_added);
+
+        if ((rate < MIN_STATES_PER_S) || (s->max_age > MAX_STATE_AGE)) {
+            printf("%-6s: player states too slow\n", s->name);
+            r = 1;
+        }
+
+        // the last few may still be on the way
+        if (s->errors || ((uint8_t)(sides[1 - i].shots_sent - s->shots_rcvd) > 4)) {
+            printf("%-6s: shots lost or repeated\n", s->name);
+            r = 1;
+        }
+    }
+
+    if (link_down) {
+        printf("link timed out\n");
+        r = 1;
+    }
+
+    printf(r ? "FAIL\n" : "OK\n");
+    return r;
+}
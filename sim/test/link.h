@@ -0,0 +1,80 @@
+/*
+ * link.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Included in front of src/multiplayer.c, which is compiled
+ * once for each end of the cable with LINK_SIDE set to a or b.
+ * The exported names get that prefix and the serial registers
+ * and interrupt handlers point to struct link_side, so both
+ * copies can run against each other in sim/test/link.c.
+ */
+
+#ifndef __LINK_H__
+#define __LINK_H__
+
+#include <stdint.h>
+
+struct link_side {
+    uint8_t sb, sc, ie, iflag;
+    void (*sio)(void);
+    void (*tim)(void);
+};
+
+#define SIOF_XFER_START 0x80
+#define SIOF_CLOCK_INT 0x01
+#define SIOF_CLOCK_EXT 0x00
+#define TIM_IFLAG 0x04
+#define SIO_IFLAG 0x08
+
+#ifdef LINK_SIDE
+
+#define LINK_CAT2(s, x) s##_##x
+#define LINK_CAT(s, x) LINK_CAT2(s, x)
+#define LINK(x) LINK_CAT(LINK_SIDE, x)
+
+extern struct link_side LINK(link);
+
+#define SB_REG (LINK(link).sb)
+#define SC_REG (LINK(link).sc)
+#define IE_REG (LINK(link).ie)
+#define IF_REG (LINK(link).iflag)
+#define set_interrupts(x) (LINK(link).ie = (x))
+#define add_SIO(f) (LINK(link).sio = (f))
+#define remove_SIO(f) (LINK(link).sio = NULL)
+#define add_TIM(f) (LINK(link).tim = (f))
+#define remove_TIM(f) (LINK(link).tim = NULL)
+
+#define mp_master_ready LINK(mp_master_ready)
+#define mp_master_start LINK(mp_master_start)
+#define mp_slave_ready LINK(mp_slave_ready)
+#define mp_slave_start LINK(mp_slave_start)
+#define mp_handle LINK(mp_handle)
+#define mp_new_state LINK(mp_new_state)
+#define mp_add_shot LINK(mp_add_shot)
+#define mp_connection_status LINK(mp_connection_status)
+#define mp_is_master LINK(mp_is_master)
+
+#define game LINK(game)
+#define game_init LINK(game_init)
+#define game_set_mp_player2 LINK(game_set_mp_player2)
+#define game_set_mp_shot LINK(game_set_mp_shot)
+
+#endif // LINK_SIDE
+
+#endif // __LINK_H__
@@ -0,0 +1,367 @@
+/*
+ * sfx.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs short scripts of effect requests through src/sample.c and
+ * checks which sample plays, what lands in the queue and which
+ * tones are triggered on the other channels. The wave interrupt
+ * is modelled by counting down the length of the playing sample
+ * at the tick rate of src/sample.h, one frame at a time.
+ *
+ * The Makefile strips the assembly of sample_isr() from a copy
+ * of src/sample.c, which is included here to see its state.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <gbdk/platform.h>
+#include "gb/hardware.h"
+
+// the effects keep their banks in a constant table
+#undef BANK
+#define BANK(x) 1
+
+#include "sample_sim.c"
+
+#define CPU_HZ 4194304UL
+#define FRAME_CYCLES 70224UL
+
+uint8_t _current_bank = 1;
+volatile uint8_t sim_regs[0x100];
+struct config_mem mem;
+
+static const char *test = "";
+static unsigned long frame = 0;
+static unsigned long tick_acc = 0;
+static int errors = 0;
+static int verbose = 0;
+
+static void usage(const char *name) {
+    printf("Usage: %s [-v]\n", name);
+}
+
+#define expect(c, ...) do {                                   \
+    if (!(c)) {                                               \
+        printf("%s: frame %lu: ", test, frame);               \
+        printf(__VA_ARGS__);                                  \
+        printf("\n");                                         \
+        errors++;                                             \
+    }                                                         \
+} while (0)
+
+static const char *sfx_name(enum SFXS sfx) {
+    static const char *names[SFX_COUNT + 1] = {
+        "shot", "orb", "ship", "damage", "heal", "none",
+    };
+    return names[(sfx < SFX_COUNT) ? sfx : SFX_COUNT];
+}
+
+static void start(const char *name) {
+    test = name;
+    frame = 0;
+    tick_acc = 0;
+
+    // nothing left over from the test before
+    play_sfx = SFX_COUNT;
+    play_length = 0;
+    sample_reset();
+}
+
+static void done(int before) {
+    if (errors == before) {
+        printf("%-15s: OK\n", test);
+    }
+}
+
+// one frame of wave interrupts, then the sample_update() of the next
+static void step(void) {
+    tick_acc += SAMPLE_TICK_HZ * FRAME_CYCLES;
+    while (tick_acc >= CPU_HZ) {
+        tick_acc -= CPU_HZ;
+        if (play_length > 0) {
+            play_length--;
+        }
+    }
+
+    frame++;
+    sample_update();
+
+    if (verbose) {
+        printf("%s: frame %lu: %s, %u left\n", test, frame, sfx_name(play_sfx), play_length);
+    }
+}
+
+static void steps(unsigned long n) {
+    while (n--) {
+        step();
+    }
+}
+
+// the channels sample_play() triggered a tone on, bit 0 for pulse, 1 for noise
+static uint8_t request(enum SFXS sfx) {
+    NR24_REG = 0;
+    NR44_REG = 0;
+
+    sample_play(sfx);
+
+    return ((NR24_REG & 0x80) ? 1 : 0) | ((NR44_REG & 0x80) ? 2 : 0);
+}
+
+static uint8_t queued(enum SFXS sfx) {
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if ((queue[i].ttl > 0) && (queue[i].sfx == sfx)) {
+            return queue[i].ttl;
+        }
+    }
+    return 0;
+}
+
+static uint8_t queue_used(void) {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if (queue[i].ttl > 0) {
+            n++;
+        }
+    }
+    return n;
+}
+
+static void expect_playing(enum SFXS sfx) {
+    expect(sample_running() && (play_sfx == sfx), "%s playing instead of %s",
+           sample_running() ? sfx_name(play_sfx) : "nothing", sfx_name(sfx));
+}
+
+// steps until the playing sample ended, returns what came next
+static enum SFXS play_out(void) {
+    enum SFXS sfx = play_sfx;
+    while (sample_running() && (play_sfx == sfx)) {
+        step();
+    }
+    return sample_running() ? play_sfx : SFX_COUNT;
+}
+
+static void test_start(void) {
+    int e = errors;
+    start("start");
+
+    expect(request(SFX_SHOT) == 0, "tone instead of the sample");
+    expect_playing(SFX_SHOT);
+    expect(play_length == sfxs[SFX_SHOT].len, "length %u", play_length);
+    expect(play_out() == SFX_COUNT, "something followed");
+
+    done(e);
+}
+
+static void test_cutoff(void) {
+    int e = errors;
+    start("cutoff");
+
+    request(SFX_SHOT);
+    step();
+    expect(request(SFX_EXPL_ORB) == 0, "tone instead of the sample");
+    expect_playing(SFX_EXPL_ORB);
+
+    // the shot is less important, so it plays as a tone on channel 2
+    step();
+    uint16_t left = play_length;
+    expect(request(SFX_SHOT) == 1, "no pulse tone for the shot");
+    expect(NR23_REG == (tone_shot.freq & 0xFF), "tone frequency %02X", NR23_REG);
+    expect_playing(SFX_EXPL_ORB);
+    expect(play_length == left, "orb restarted");
+
+    // the ship explosion cuts off everything
+    expect(request(SFX_EXPL_SHIP) == 0, "tone instead of the sample");
+    expect_playing(SFX_EXPL_SHIP);
+    expect(queue_used() == 0, "the orb got queued");
+    expect(play_out() == SFX_COUNT, "something followed");
+
+    done(e);
+}
+
+static void test_retrigger(void) {
+    int e = errors;
+    start("retrigger");
+
+    request(SFX_SHOT);
+    steps(3);
+    expect(play_length < sfxs[SFX_SHOT].len, "not playing");
+    expect(request(SFX_SHOT) == 0, "tone instead of a restart");
+    expect_playing(SFX_SHOT);
+    expect(play_length == sfxs[SFX_SHOT].len, "not restarted, %u left", play_length);
+
+    done(e);
+}
+
+static void test_repeat(void) {
+    int e = errors;
+    start("repeat");
+
+    // a repeat of the playing orb can not restart it, but has a tone
+    request(SFX_EXPL_ORB);
+    steps(3);
+    uint16_t left = play_length;
+    expect(request(SFX_EXPL_ORB) == 2, "no noise tone for the repeat");
+    expect(NR43_REG == tone_expl_orb.freq, "tone frequency %02X", NR43_REG);
+    expect(play_length == left, "orb restarted");
+    expect(queue_used() == 0, "the repeat got queued");
+
+    // damage has no tone, and a queued repeat would sound twice
+    start("repeat");
+    request(SFX_DAMAGE);
+    steps(3);
+    left = play_length;
+    expect(request(SFX_DAMAGE) == 0, "tone for damage");
+    expect(play_length == left, "damage restarted");
+    expect(queue_used() == 0, "the repeat got queued");
+    expect(play_out() == SFX_COUNT, "something followed");
+
+    done(e);
+}
+
+static void test_queue(void) {
+    int e = errors;
+    start("queue");
+
+    // equal priority waits for the end of the playing one
+    request(SFX_DAMAGE);
+    unsigned long end = sfxs[SFX_DAMAGE].len * CPU_HZ / (SAMPLE_TICK_HZ * FRAME_CYCLES);
+    steps(end - sfxs[SFX_HEAL].ttl + 5);
+    expect(request(SFX_HEAL) == 0, "tone for heal");
+    expect(queued(SFX_HEAL) == sfxs[SFX_HEAL].ttl, "heal not queued");
+    expect_playing(SFX_DAMAGE);
+    expect(play_out() == SFX_HEAL, "heal did not follow");
+    expect(queue_used() == 0, "heal still queued");
+    expect(play_out() == SFX_COUNT, "something followed heal");
+
+    done(e);
+}
+
+static void test_ttl(void) {
+    int e = errors;
+    start("ttl");
+
+    // waits too long, the damage is longer than the ttl of heal
+    request(SFX_DAMAGE);
+    step();
+    request(SFX_HEAL);
+    expect(queued(SFX_HEAL), "heal not queued");
+    steps(sfxs[SFX_HEAL].ttl);
+    expect(queue_used() == 0, "heal still queued");
+    expect(play_out() == SFX_COUNT, "heal played after its ttl");
+
+    // asking again refreshes the ttl instead of taking another slot
+    start("ttl");
+    request(SFX_DAMAGE);
+    step();
+    request(SFX_HEAL);
+    while (queued(SFX_HEAL) > 2) {
+        step();
+    }
+    step(); // heal is an edge, it needs a frame without the request
+    request(SFX_HEAL);
+    expect(queued(SFX_HEAL) == sfxs[SFX_HEAL].ttl, "ttl not refreshed");
+    expect(queue_used() == 1, "%u queued", queue_used());
+
+    done(e);
+}
+
+static void test_edge(void) {
+    int e = errors;
+    start("edge");
+
+    // held down for longer than the sample, it plays only once
+    unsigned long restarts = 0, frames = 0;
+    uint16_t left = 0;
+    request(SFX_HEAL);
+    expect_playing(SFX_HEAL);
+    while (frames++ < 100) {
+        left = play_length;
+        step();
+        request(SFX_HEAL);
+        if (play_length > left) {
+            restarts++;
+        }
+    }
+    expect(restarts == 0, "%lu restarts", restarts);
+    expect(!sample_running(), "still playing");
+    expect(queue_used() == 0, "queued while held");
+
+    // one frame without the request and it plays again
+    step();
+    step();
+    request(SFX_HEAL);
+    expect_playing(SFX_HEAL);
+
+    done(e);
+}
+
+static void test_reset(void) {
+    int e = errors;
+    start("reset");
+
+    // the playing sample stays, the queue is gone
+    request(SFX_DAMAGE);
+    steps(30);
+    request(SFX_HEAL);
+    expect(queued(SFX_HEAL), "heal not queued");
+    sample_reset();
+    expect(queue_used() == 0, "heal still queued");
+    expect_playing(SFX_DAMAGE);
+    expect(play_out() == SFX_COUNT, "heal played after the reset");
+
+    // held when the last game ended, sample_update() did not run since
+    start("reset");
+    request(SFX_HEAL);
+    play_length = 0;
+    sample_reset();
+    step();
+    request(SFX_HEAL);
+    expect_playing(SFX_HEAL);
+
+    done(e);
+}
+
+int main(int argc, char *argv[]) {
+    int opt;
+    while ((opt = getopt(argc, argv, "vh")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose = 1;
+                break;
+
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    test_start();
+    test_cutoff();
+    test_retrigger();
+    test_repeat();
+    test_queue();
+    test_ttl();
+    test_edge();
+    test_reset();
+
+    return errors ? 1 : 0;
+}
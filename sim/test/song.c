@@ -0,0 +1,152 @@
+/*
+ * song.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Plays every song with src/sound.c and with the old player and
+ * note arrays of sim/test/song_ref.c, side by side, one snd_play()
+ * call at a time. After every call both must have triggered the
+ * same channels with the same register values. Runs each song
+ * for -n calls, a few times through its loop by default, and the
+ * game over song must end and stay silent.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "song.h"
+#include "config.h"
+#include "sound.h"
+#include "song_ref.h"
+
+#define MUSIC_VOL 0x0A
+
+uint8_t _current_bank = 1;
+volatile uint8_t sim_regs[0x100];
+struct config_mem mem;
+
+struct trigger {
+    uint8_t len, env, freq, ctrl; // NRx1 to NRx4, NR43 as freq of the noise
+};
+
+// trigger registers of every channel, the first one is NRx1
+static const uint8_t chan_regs[SND_CHANNELS] = { 0x11, 0x16, 0x20 };
+
+static const struct {
+    const char *name;
+    enum SOUNDS snd;
+    const struct music *ref;
+} songs[SND_COUNT] = {
+    { "menu",      SND_MENU,     &ref_music_menu },
+    { "game",      SND_GAME,     &ref_music_game },
+    { "game over", SND_GAMEOVER, &ref_music_over },
+};
+
+static unsigned long calls = 50000; // three times through the menu song
+
+static void usage(const char *name) {
+    printf("Usage: %s [-n calls]\n", name);
+}
+
+// runs one player call, the triggered channels end up in t
+static uint8_t capture(void (*play)(void), struct trigger t[SND_CHANNELS]) {
+    for (uint8_t ch = 0; ch < SND_CHANNELS; ch++) {
+        sim_regs[chan_regs[ch] + 3] = 0;
+    }
+
+    play();
+
+    uint8_t mask = 0;
+    for (uint8_t ch = 0; ch < SND_CHANNELS; ch++) {
+        const volatile uint8_t *r = &sim_regs[chan_regs[ch]];
+        if (r[3] & 0x80) {
+            t[ch].len = r[0];
+            t[ch].env = r[1];
+            t[ch].freq = r[2];
+            t[ch].ctrl = r[3];
+            mask |= 1 << ch;
+        }
+    }
+    return mask;
+}
+
+static int run(uint8_t i) {
+    unsigned long notes = 0, last = 0;
+
+    snd_music(songs[i].snd);
+    ref_music(songs[i].ref);
+
+    for (unsigned long n = 0; n < calls; n++) {
+        struct trigger a[SND_CHANNELS], b[SND_CHANNELS];
+        uint8_t ma = capture(snd_play, a);
+        uint8_t mb = capture(ref_play, b);
+
+        for (uint8_t ch = 0; ch < SND_CHANNELS; ch++) {
+            uint8_t bit = 1 << ch;
+            if ((ma & bit) != (mb & bit)) {
+                printf("%s: call %lu channel %d %s\n", songs[i].name, n, ch,
+                       (ma & bit) ? "triggered, old player did not" : "not triggered, old player did");
+                return 1;
+            }
+            if ((ma & bit) && memcmp(&a[ch], &b[ch], sizeof(a[ch]))) {
+                printf("%s: call %lu channel %d wrote %02X %02X %02X %02X, old player %02X %02X %02X %02X\n",
+                       songs[i].name, n, ch,
+                       a[ch].len, a[ch].env, a[ch].freq, a[ch].ctrl,
+                       b[ch].len, b[ch].env, b[ch].freq, b[ch].ctrl);
+                return 1;
+            }
+            if (ma & bit) {
+                notes++;
+                last = n;
+            }
+        }
+    }
+
+    if ((songs[i].ref->repeat == MUSIC_NO_REPEAT) && ref_playing()) {
+        printf("%s: still playing after %lu calls\n", songs[i].name, calls);
+        return 1;
+    }
+
+    printf("%s: %lu notes match, last in call %lu\n", songs[i].name, notes, last);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int opt;
+    while ((opt = getopt(argc, argv, "n:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                calls = strtoul(optarg, NULL, 0);
+                break;
+
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    mem.config.music_vol = MUSIC_VOL;
+
+    int r = 0;
+    for (uint8_t i = 0; i < SND_COUNT; i++) {
+        r |= run(i);
+    }
+    return r;
+}
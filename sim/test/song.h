@@ -0,0 +1,35 @@
+/*
+ * song.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Included in front of src/sound.c and the song data for
+ * sim/test/song.c, with the sound registers of gb/hardware.h.
+ */
+
+#ifndef __SONG_H__
+#define __SONG_H__
+
+#include <gbdk/platform.h>
+#include "gb/hardware.h"
+
+// src/sound.c keeps the banks in a constant table
+#undef BANK
+#define BANK(x) 1
+
+#endif // __SONG_H__
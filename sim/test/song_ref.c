@@ -0,0 +1,645 @@
+/*
+ * song_ref.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The songs as they were before util/cvtsong.py, one note or drum
+ * per step on every channel, and the player that went with them.
+ * sim/test/song.c checks the converted songs against these.
+ */
+
+#include <assert.h>
+
+#include "song.h"
+#include "config.h"
+#include "song_ref.h"
+
+// sound_menu.c
+
+static const enum notes menu_music[] = {
+    // intro
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 1
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 1
+     G1,  G1,  G1,  G1, SIL, SIL, SIL, SIL, // 2
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, Ab2, // 2
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 3
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 3
+     G1,  G1,  G1,  G1, SIL, SIL, SIL, SIL, // 4
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, Ab2, // 4
+
+    // repeat 1
+
+     G2,  G2,  G3,  G3,  G4,  G4, Eb4, Eb4, // 5
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 5
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 6
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 6
+
+     G2,  G2,  D2,  D2,  G4,  G4, Eb4, Eb4, // 7
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 7
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 8
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 8
+
+     G2,  G2,  G3,  G3,  G4,  G4, Eb4, Eb4, // 9
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 9
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 10
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 10
+
+     G2,  G2,  D2,  D2,  G4,  G4, Eb4, Eb4, // 11
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 11
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 12
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 12
+
+    // bridge
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 13
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 13
+     G1,  G1,  G3,  D4,  D4,  G3, Db4, Db4, // 14
+     G3,  C4, Bb1, Bb1, SIL, SIL,  G3,  G3, // 14
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 15
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 15
+     G1,  G1,  G3,  D4,  D4,  G3, Db4, Db4, // 16
+     G3,  C4, Bb1,  G3, Bb3, Bb3,  G3,  G3, // 16
+
+    // repeat 2
+
+     G2,  G2,  D2,  D2,  G4,  G4, Eb4, Eb4, // 17
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 17
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 18
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 18
+
+     G2,  G2,  D2,  D2,  G4,  G4, Eb4, Eb4, // 19
+     D4, Eb4,  D4,  C4,  D4,  D4,  D4,  G1, // 19
+     G1,  G1, Bb3, Bb3,  C4, Bb3,  C4,  C4, // 20
+     D4,  D4,  G3,  G3,  C4,  C4, Bb3,  G3, // 20
+
+    // bridge
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 21
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 21
+     G1,  G1,  G3,  D4,  D4,  G3, Db4, Db4, // 22
+     G3,  C4, Bb1, Bb1, SIL, SIL,  G3,  G3, // 22
+
+     G2,  G2,  D2,  D2,  F1,  F1,  G1,  G1, // 23
+     G1,  G1, SIL, SIL, SIL, SIL, SIL,  G1, // 23
+     G1,  G1,  G3,  D4,  D4,  G3, Db4, Db4, // 24
+     G3,  C4, Bb1,  G3, Bb3, Bb3,  G3,  G3, // 24
+
+    // end
+
+     G2,  G2,  G2,  G2, SIL, SIL,  G1,  G1, // 25
+     G1,  G1,  G1,  G1,  G1,  G1,  G1,  G1, // 25
+     G1,  G1,  G1,  G1, SIL, SIL, SIL, SIL, // 26
+
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    END
+};
+
+static const enum notes menu_music2[] = {
+    // intro
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    // repeat 1
+
+    SIL, SIL,  D2,  D2,  F1,  F1,  G1,  G1,
+     G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    SIL, SIL, SIL, SIL,  F1,  F1,  G1,  G1,
+    G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    SIL, SIL,  D2,  D2,  F1,  F1,  G1,  G1,
+    G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    SIL, SIL, SIL, SIL,  F1,  F1,  G1,  G1,
+    G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    // bridge
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL,  G3, Bb3, Bb3, Ab2, Ab2,
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, Ab2, Ab2,
+
+    // repeat 2
+
+    SIL, SIL, SIL, SIL,  F1,  F1,  G1,  G1,
+    G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    SIL, SIL, SIL, SIL,  F1,  F1,  G1,  G1,
+    G1,  G1, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, Bb1, Bb1, Bb1, Bb1, Ab2, SIL,
+
+    // bridge
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL,  G3, Bb3, Bb3, Ab2, Ab2,
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, Ab2, Ab2,
+
+    // end
+
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    END
+};
+
+#define DRUM_LOOP \
+    dSI, dSI, dSn, dSI, dKi, dSI, dSI, dSI, \
+    dSn, dSI, dSI, dSI, dKi, dSI, dSI, dSI  \
+
+static const enum drums menu_drums[] = {
+    // intro
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    // repeat 1
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    // bridge
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    // repeat 2
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    // bridge
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    // end
+
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dEND
+};
+
+static_assert(sizeof(menu_music)  == sizeof(menu_music2), "music loops need to be same length");
+static_assert(sizeof(menu_music2) == sizeof(menu_drums),  "music loops need to be same length");
+static_assert(sizeof(menu_music)  == sizeof(menu_drums),  "music loops need to be same length");
+
+const struct music ref_music_menu = {
+    .notes = menu_music,
+    .notes2 = menu_music2,
+    .drums = menu_drums,
+    .duration = 150,
+    .repeat = 0,
+};
+#undef DRUM_LOOP
+
+// sound_game.c
+
+#define NOTE_LOOP \
+    F1,  F1,  F1,  G1, Gd2, Gd1, Cd1,  D1, \
+    D2,  D2,  D2, Fd1, Fd1,  D2,  D2,  D2
+
+// TODO
+#define DIFF_LOOP \
+    F1,  F1,  F1,  G1, Gd2, Gd1, Cd1,  D1, \
+    D2,  D2,  D2, Fd1, Fd1,  D2,  D2,  D2
+
+static const enum notes game_music[] = {
+    NOTE_LOOP, NOTE_LOOP, NOTE_LOOP, NOTE_LOOP,
+    NOTE_LOOP, NOTE_LOOP, NOTE_LOOP, NOTE_LOOP,
+
+    NOTE_LOOP, NOTE_LOOP, NOTE_LOOP, NOTE_LOOP,
+
+    DIFF_LOOP, DIFF_LOOP, DIFF_LOOP, DIFF_LOOP,
+
+    NOTE_LOOP, NOTE_LOOP, NOTE_LOOP, NOTE_LOOP,
+
+    END
+};
+
+#define DRUM_LOOP \
+dSn, dSI, dSn, dSI, dKi, dSI, dSI, dSI, \
+dSn, dSI, dSn, dSI, dKi, dSI, dSI, dSI  \
+
+#define SILE_LOOP \
+dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI, \
+dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI  \
+
+static const enum drums game_drums[] = {
+    DRUM_LOOP, DRUM_LOOP, DRUM_LOOP, DRUM_LOOP,
+    DRUM_LOOP, DRUM_LOOP, DRUM_LOOP, DRUM_LOOP,
+
+    SILE_LOOP, SILE_LOOP, SILE_LOOP, SILE_LOOP,
+
+    DRUM_LOOP, DRUM_LOOP, DRUM_LOOP, DRUM_LOOP,
+    DRUM_LOOP, DRUM_LOOP, DRUM_LOOP, DRUM_LOOP,
+
+    dEND
+};
+
+static_assert(sizeof(game_music) == sizeof(game_drums), "music loops need to be same length");
+
+const struct music ref_music_game = {
+    .notes = game_music,
+    .notes2 = NULL,
+    .drums = game_drums,
+    .duration = 160,
+    .repeat = 0,
+};
+#undef NOTE_LOOP
+#undef DIFF_LOOP
+#undef DRUM_LOOP
+#undef SILE_LOOP
+
+// sound_over.c
+
+static const enum notes over_notes[] = {
+    // repeat 1
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+     A4,  C5,  A4,  F4,  A4,  A4,  A4,  C5,
+     A4,  F4,  A4, Bb4,  C5, Bb4,  A4,  F4,
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+    Ab4,  C5, Ab4,  E4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  E4, Ab4, Bb4,  C5, Bb4, Ab4,  E4,
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+     A4,  C5,  A4,  F4,  A4,  A4,  A4,  C5,
+     A4,  F4,  A4, Bb4,  C5, Bb4,  A4,  F4,
+
+    Bb4, Db5, Bb4, Gb4, Bb4, Bb4, Bb4, Db5,
+    Bb4, Gb4, Bb4,  C5, Db5,  C5, Bb4, Gb4,
+
+    Bb4, Db5, Bb4, Gb4, Bb4, Bb4, Bb4, Db5,
+    Bb4, Gb4, Bb4,  C5, Db5,  C5, Bb4, Gb4,
+
+    Bb4,  D5, Bb4,  G4, Bb4, Bb4, Bb4, D5,
+    Bb4,  G4, Bb4,  C5,  D5,  C5, Bb4, G4,
+
+    Bb4,  D5, Bb4,  G4, Bb4, Bb4, Bb4, D5,
+    Bb4,  G4, Bb4,  C5,  D5,  C5, Bb4, G4,
+
+    // repeat 2
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+    A4,  C5,  A4,  F4,  A4,  A4,  A4,  C5,
+    A4,  F4,  A4, Bb4,  C5, Bb4,  A4,  F4,
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+    Ab4,  C5, Ab4,  E4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  E4, Ab4, Bb4,  C5, Bb4, Ab4,  E4,
+
+    Ab4,  C5, Ab4,  F4, Ab4, Ab4, Ab4,  C5,
+    Ab4,  F4, Ab4, Bb4,  C5, Bb4, Ab4,  F4,
+
+    A4,  C5,  A4,  F4,  A4,  A4,  A4,  C5,
+    A4,  F4,  A4, Bb4,  C5, Bb4,  A4,  F4,
+
+    Bb4, Db5, Bb4, Gb4, Bb4, Bb4, Bb4, Db5,
+    Bb4, Gb4, Bb4,  C5, Db5,  C5, Bb4, Gb4,
+
+    Bb4, Db5, Bb4, Gb4, Bb4, Bb4, Bb4, Db5,
+    Bb4, Gb4, Bb4,  C5, Db5,  C5, Bb4, Gb4,
+
+    Bb4,  D5, Bb4,  G4, Bb4, Bb4, Bb4, D5,
+    Bb4,  G4, Bb4,  C5,  D5,  C5, Bb4, G4,
+
+    Bb4, Dd5, Bb4,  G4, Bb4, Bb4, Bb4, D5,
+    Bb4,  G4, Bb4,  C5,  D5,  C5, Bb4, G4,
+
+    // end
+
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    END
+};
+
+#define ADD_LOOP \
+    Ab2, SIL, Ab2, SIL, Ab2, SIL, Ab2, SIL, \
+    Ab2, SIL, Ab2, SIL, Ab2, SIL, Ab2, SIL
+
+#define ADD_LOOP_2 \
+     A2, SIL,  A2, SIL,  A2, SIL,  A2, SIL, \
+     A2, SIL,  A2, SIL,  A2, SIL,  A2, SIL
+
+#define ADD_LOOP_3 \
+     E2, SIL,  E2, SIL,  E2, SIL,  E2, SIL, \
+     E2, SIL,  E2, SIL,  E2, SIL,  E2, SIL
+
+static const enum notes over_notes2[] = {
+    // repeat 1
+
+    ADD_LOOP, ADD_LOOP_2,
+    ADD_LOOP, ADD_LOOP_3,
+    ADD_LOOP, ADD_LOOP_2,
+
+    Db3, Db3, Db3, Db3, Db3, Db3, Db3, Db3,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+     D3,  D3,  D3,  D3,  D3,  D3,  D3,  D3,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    // repeat 2
+
+    ADD_LOOP, ADD_LOOP_2,
+    ADD_LOOP, ADD_LOOP_3,
+    ADD_LOOP, ADD_LOOP_2,
+
+    Db3, Db3, Db3, Db3, Db3, Db3, Db3, Db3,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    D3,  D3,  D3,  D3,  D3,  D3,  D3,  D3,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+    SIL, SIL, SIL, SIL, SIL, SIL, SIL, SIL,
+
+    // end
+
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    SILENCE, SILENCE, SILENCE, SILENCE,
+    END
+};
+
+#define DRUM_LOOP \
+    dKi, dSI, dSI, dSI, dSI, dSI, dKi, dSI, \
+    dSn, dSI, dSI, dSI, dKi, dSI, dSI, dSI  \
+
+static const enum drums over_drums[] = {
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+    DRUM_LOOP,
+
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dSI, dSI, dSI, dSI, dSI, dSI, dSI, dSI,
+    dEND
+};
+
+static_assert(sizeof(over_notes)  == sizeof(over_notes2), "music loops need to be same length");
+static_assert(sizeof(over_notes2) == sizeof(over_drums),  "music loops need to be same length");
+static_assert(sizeof(over_notes)  == sizeof(over_drums),  "music loops need to be same length");
+
+const struct music ref_music_over = {
+    .notes = over_notes,
+    .notes2 = over_notes2,
+    .drums = over_drums,
+    .duration = 120,
+    .repeat = MUSIC_NO_REPEAT,
+};
+#undef ADD_LOOP
+#undef ADD_LOOP_2
+#undef ADD_LOOP_3
+#undef DRUM_LOOP
+
+// sound.c
+
+static const uint16_t frequencies[SILENCE] = {
+      44,  156,  262,  363,  457,  547,  631,  710,  786,  854,  923,  986, //  0 .. 11
+    1046, 1102, 1155, 1205, 1253, 1297, 1339, 1379, 1417, 1452, 1486, 1517, // 12 .. 23
+    1546, 1575, 1602, 1627, 1650, 1673, 1694, 1714, 1732, 1750, 1767, 1783, // 24 .. 35
+    1798, 1812, 1825, 1837, 1849, 1860, 1871, 1881, 1890, 1899, 1907, 1915, // 36 .. 47
+    1923, 1930, 1936, 1943, 1949, 1954, 1959, 1964, 1969, 1974, 1978, 1982, // 48 .. 59
+    1985, 1988, 1992, 1995, 1998, 2001, 2004, 2006, 2009, 2011, 2013, 2015  // 60 .. 71
+};
+
+static const struct music *music = NULL;
+static uint8_t duration;
+static uint16_t off = 0;
+static uint16_t last_t = 0;
+static uint16_t now = 0;
+
+#define CALL_TICKS 4 // timer_get() units per call, TIMER_HZ / 256
+
+static void play_note(enum notes note) {
+    if (note < SILENCE) {
+        uint16_t freq = frequencies[note];
+        NR11_REG = 0x80 | duration;
+        NR12_REG = (conf_get()->music_vol << 4) | 0x00;
+        NR13_REG = freq & 0xFF;
+        NR14_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07);
+    }
+}
+
+static void play_note2(enum notes note) {
+    if (note < SILENCE) {
+        uint16_t freq = frequencies[note];
+        NR21_REG = 0x80 | duration;
+        NR22_REG = (conf_get()->music_vol << 4) | 0x00;
+        NR23_REG = freq & 0xFF;
+        NR24_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07);
+    }
+}
+
+static void play_drum(enum drums drum) {
+    switch (drum) {
+        case dKick:
+            NR41_REG = 0x2F;
+            NR42_REG = (conf_get()->music_vol << 4) | 0x00;
+            NR43_REG = 0x11;
+            NR44_REG = 0xC0;
+            break;
+
+        case dSnare:
+            NR41_REG = 0x10;
+            NR42_REG = (conf_get()->music_vol << 4) | 0x02;
+            NR43_REG = 0x46;
+            NR44_REG = 0xC0;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void ref_music(const struct music *snd) {
+    uint16_t d = (snd->duration >> 2) + 1;
+    music = snd;
+    duration = 0x3F - ((d < 0x3F) ? d : 0x3F);
+    off = 0;
+    last_t = now;
+}
+
+static void ref_step(void) {
+    if (!music) {
+        return;
+    }
+
+    uint16_t diff = now - last_t;
+    if (diff >= music->duration) {
+        if (music->notes) {
+            if (music->notes[off] != END) {
+                play_note(music->notes[off]);
+            } else {
+                if (music->repeat != MUSIC_NO_REPEAT) {
+                    off = music->repeat;
+                    ref_step();
+                    return;
+                } else {
+                    music = NULL;
+                    return;
+                }
+            }
+        }
+
+        if (music && music->notes2) {
+            if (music->notes2[off] != END) {
+                play_note2(music->notes2[off]);
+            } else {
+                if (music->repeat != MUSIC_NO_REPEAT) {
+                    off = music->repeat;
+                    ref_step();
+                    return;
+                } else {
+                    music = NULL;
+                    return;
+                }
+            }
+        }
+
+        if (music && music->drums) {
+            if (music->drums[off] != dEND) {
+                play_drum(music->drums[off]);
+            } else {
+                if (music->repeat != MUSIC_NO_REPEAT) {
+                    off = music->repeat;
+                    ref_step();
+                    return;
+                } else {
+                    music = NULL;
+                    return;
+                }
+            }
+        }
+
+        off++;
+        last_t += music->duration;
+    }
+}
+
+void ref_play(void) {
+    now += CALL_TICKS;
+    ref_step();
+}
+
+uint8_t ref_playing(void) {
+    return music != NULL;
+}
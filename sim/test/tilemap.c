@@ -0,0 +1,382 @@
+/*
+ * tilemap.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Streams generated maps through src/maps.c and checks after
+ * every VBlank that the visible part of the 32x32 tilemap shows
+ * the expected part of the repeating world. The VRAM queue is
+ * modelled with the same length and VBlank budget as src/vram.c,
+ * with -b adding up to that many commands of other users per
+ * frame. Runs every size below for the DMG, and for the GBC with
+ * and without mirroring, unless -W and -H select a single size.
+ *
+ * The defaults are the fastest the ship flies, with up to four
+ * fixed steps per frame. At debug speeds the queue can not keep
+ * up on the GBC, so -l only checks once the camera stopped.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tilemap.h"
+#include "config.h"
+#include "map_data.h"
+#include "maps.h"
+#include "vram.h"
+#include "lz.h"
+
+#define HW_SIZE 32
+#define VIS_W (DEVICE_SCREEN_WIDTH + 1)
+#define VIS_H (DEVICE_SCREEN_HEIGHT + 1)
+#define POS_SCALE 6 // POS_SCALE_BG in maps.c
+
+// same as src/vram.c
+#define QUEUE_LEN 32 // one slot stays empty
+#define VBL_BUDGET 48
+#define CMD_COST 4
+
+#define TILE_OFFSET 0x20
+#define PALETTE 2
+#define FLIP_X 0x20
+#define FLIP_Y 0x40
+
+struct cmd {
+    uint8_t vbk;
+    uint8_t x, y, w, h;
+    uint8_t data[VRAM_DATA_LEN];
+};
+
+uint8_t _current_bank = 1;
+uint8_t _cpu = DMG_TYPE;
+volatile uint8_t sim_regs[0x100];
+struct config_mem mem;
+
+BANKREF(map_data)
+const palette_color_t num_pal_inv[INV_PALETTE_COUNT * 4];
+struct maps maps[MAP_COUNT];
+
+static uint8_t bkg[2][HW_SIZE][HW_SIZE];
+static uint8_t scx, scy;
+
+static struct cmd queue[QUEUE_LEN];
+static uint8_t head = 0, tail = 0;
+
+static uint32_t frames = 5000;
+static int16_t max_speed = 23; // table_speed_move, see Makefile
+static uint8_t max_steps = 4; // STEP_MAX in game.c
+static uint8_t allow_lag = 0;
+static uint8_t busy = 2;
+static uint32_t errors = 0;
+
+// ----------------------------------------------------------------------------
+// GBDK and the rest of the game
+// ----------------------------------------------------------------------------
+
+void set_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles) {
+    uint8_t b = (VBK_REG == VBK_ATTRIBUTES) ? 1 : 0;
+    for (uint8_t j = 0; j < h; j++) {
+        for (uint8_t i = 0; i < w; i++) {
+            bkg[b][(y + j) & (HW_SIZE - 1)][(x + i) & (HW_SIZE - 1)] = tiles[(j * w) + i];
+        }
+    }
+}
+
+void set_bkg_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles, uint8_t base) { }
+void set_win_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles, uint8_t base) { }
+void fill_bkg_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile) { }
+void fill_win_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile) { }
+void set_bkg_palette(uint8_t first, uint8_t count, const palette_color_t *colors) { }
+void move_win(uint8_t x, uint8_t y) { }
+
+void move_bkg(uint8_t x, uint8_t y) {
+    scx = x;
+    scy = y;
+}
+
+void lz_begin(const uint8_t *data, uint8_t bank) { }
+void lz_bkg_data(uint8_t first, uint16_t count) { }
+void lz_report(void) BANKED { }
+
+// ----------------------------------------------------------------------------
+// VRAM queue
+// ----------------------------------------------------------------------------
+
+uint8_t vram_space(void) {
+    return (head - tail - 1) & (QUEUE_LEN - 1);
+}
+
+static uint8_t push(uint8_t vbk, uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *data) {
+    if (vram_space() == 0) {
+        return 0;
+    }
+
+    struct cmd *c = &queue[tail];
+    c->vbk = vbk;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    if (data) {
+        memcpy(c->data, data, w * h);
+    }
+    tail = (tail + 1) & (QUEUE_LEN - 1);
+    return 1;
+}
+
+uint8_t vram_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles) {
+    return push(VBK_TILES, x, y, w, h, tiles);
+}
+
+uint8_t vram_bkg_attrs(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *attrs) {
+    return push(VBK_ATTRIBUTES, x, y, w, h, attrs);
+}
+
+static void vram_run(uint16_t budget) {
+    while (head != tail) {
+        struct cmd *c = &queue[head];
+        uint16_t cost = CMD_COST;
+
+        // w is zero for the other users, like the score digits
+        if (c->w > 0) {
+            uint8_t vbk = VBK_REG;
+            VBK_REG = c->vbk;
+            set_bkg_tiles(c->x, c->y, c->w, c->h, c->data);
+            VBK_REG = vbk;
+            cost += c->w * c->h;
+        } else {
+            cost += c->h;
+        }
+
+        head = (head + 1) & (QUEUE_LEN - 1);
+        if (cost >= budget) {
+            break;
+        }
+        budget -= cost;
+    }
+}
+
+void vram_flush(void) {
+    vram_run(0xFFFF);
+}
+
+// ----------------------------------------------------------------------------
+// Test
+// ----------------------------------------------------------------------------
+
+// map tile and flip for a world tile along one axis
+static uint16_t expect(int32_t t, uint8_t size, uint8_t mirror, uint8_t *flip, uint8_t flip_bit) {
+    uint16_t period = mirror ? (2 * size) : size;
+    int32_t s = t % period;
+    if (s < 0) {
+        s += period;
+    }
+
+    if (s >= size) {
+        *flip |= flip_bit;
+        return period - 1 - s;
+    }
+    return s;
+}
+
+static int32_t floor_div(int32_t a, int32_t b) {
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static uint8_t check(const char *name, uint32_t frame, int32_t ux, int32_t uy) {
+    const struct maps *m = &maps[MAP_GAME_1];
+    uint8_t cgb = (_cpu == CGB_TYPE);
+    uint8_t mirror = m->mirror && cgb;
+
+    int32_t px = floor_div(ux, 1 << POS_SCALE);
+    int32_t py = floor_div(uy, 1 << POS_SCALE);
+    if ((scx != (uint8_t)px) || (scy != (uint8_t)py)) {
+        printf("%s: frame %u, scroll %u,%u instead of %u,%u\n",
+               name, frame, scx, scy, (uint8_t)px, (uint8_t)py);
+        return 1;
+    }
+
+    int32_t tx = floor_div(px, 8);
+    int32_t ty = floor_div(py, 8);
+    for (uint8_t j = 0; j < VIS_H; j++) {
+        for (uint8_t i = 0; i < VIS_W; i++) {
+            uint8_t flip = 0;
+            uint16_t sx = expect(tx + i, m->width, mirror, &flip, FLIP_X);
+            uint16_t sy = expect(ty + j, m->height, mirror, &flip, FLIP_Y);
+            uint8_t tile = m->map[(sy * m->width) + sx] + TILE_OFFSET;
+            uint8_t attr = PALETTE | flip;
+
+            uint8_t hx = (tx + i) & (HW_SIZE - 1);
+            uint8_t hy = (ty + j) & (HW_SIZE - 1);
+            if ((bkg[0][hy][hx] != tile) || (cgb && (bkg[1][hy][hx] != attr))) {
+                printf("%s: frame %u, tile %d,%d is %02X/%02X instead of %02X/%02X\n",
+                       name, frame, tx + i, ty + j,
+                       bkg[0][hy][hx], bkg[1][hy][hx], tile, cgb ? attr : 0);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void run(uint8_t w, uint8_t h, uint8_t cgb, uint8_t mirror) {
+    char name[32];
+    snprintf(name, sizeof(name), "%ux%u %s%s", w, h, cgb ? "GBC" : "DMG", mirror ? " mirrored" : "");
+
+    uint8_t *data = malloc(w * h);
+    for (uint16_t i = 0; i < (w * h); i++) {
+        data[i] = rand() & 0xFF;
+    }
+
+    memset(maps, 0, sizeof(maps));
+    maps[MAP_GAME_1].width = w;
+    maps[MAP_GAME_1].height = h;
+    maps[MAP_GAME_1].map = data;
+    maps[MAP_GAME_1].map_count = w * h;
+    maps[MAP_GAME_1].tile_offset = TILE_OFFSET;
+    maps[MAP_GAME_1].palette_index = PALETTE;
+    maps[MAP_GAME_1].bank = 1;
+    maps[MAP_GAME_1].mirror = mirror;
+
+    _cpu = cgb ? CGB_TYPE : DMG_TYPE;
+    memset(bkg, 0xEE, sizeof(bkg));
+    head = tail = 0;
+
+    map_game(MAP_GAME_1);
+
+    int32_t ux = 0, uy = 0;
+    int16_t vx = 0, vy = 0;
+    uint32_t failed = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        // the score and other users of the queue go first
+        uint8_t others = busy ? (rand() % (busy + 1)) : 0;
+        for (uint8_t i = 0; i < others; i++) {
+            push(VBK_TILES, 0, 4, 0, 4, NULL);
+        }
+
+        uint8_t steps = 1 + (rand() % max_steps);
+        for (uint8_t s = 0; s < steps; s++) {
+            vx += (rand() % 33) - 16;
+            vy += (rand() % 33) - 16;
+            vx = (vx > max_speed) ? max_speed : ((vx < -max_speed) ? -max_speed : vx);
+            vy = (vy > max_speed) ? max_speed : ((vy < -max_speed) ? -max_speed : vy);
+
+            map_move(vx, vy);
+            ux += vx;
+            uy += vy;
+        }
+
+        vram_run(VBL_BUDGET);
+
+        if (!allow_lag && check(name, f, ux, uy)) {
+            if (++failed >= 5) {
+                break;
+            }
+        }
+    }
+
+    // standing still, everything queued has to arrive
+    for (uint8_t f = 0; f < 60; f++) {
+        map_move(0, 0);
+        vram_run(VBL_BUDGET);
+    }
+    failed += check(name, frames, ux, uy);
+
+    printf("%-20s: %s\n", name, failed ? "FAIL" : "OK");
+    errors += failed;
+    free(data);
+}
+
+static void usage(const char *name) {
+    printf("usage: %s [-n frames] [-v max speed] [-k max steps] [-b busy] [-l] [-W width -H height] [-s seed]\n", name);
+}
+
+int main(int argc, char *argv[]) {
+    static const uint8_t sizes[][2] = {
+        { 32, 32 }, { 20, 18 }, { 21, 19 }, { 7, 5 }, { 1, 1 },
+        { 45, 33 }, { 64, 64 }, { 255, 3 }, { 3, 255 }, { 255, 255 },
+    };
+    unsigned int seed = 1;
+    unsigned int w = 0, h = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:v:k:b:lW:H:s:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                frames = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'v':
+                max_speed = strtol(optarg, NULL, 0);
+                break;
+
+            case 'k':
+                max_steps = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'b':
+                busy = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'l':
+                allow_lag = 1;
+                break;
+
+            case 'W':
+                w = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'H':
+                h = strtoul(optarg, NULL, 0);
+                break;
+
+            case 's':
+                seed = strtoul(optarg, NULL, 0);
+                break;
+
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    srand(seed);
+
+    if ((max_steps == 0) || (w > 255) || (h > 255) || ((w == 0) != (h == 0))) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    for (uint8_t i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++) {
+        uint8_t mw = w ? w : sizes[i][0];
+        uint8_t mh = h ? h : sizes[i][1];
+
+        run(mw, mh, 0, 0);
+        run(mw, mh, 1, 0);
+        run(mw, mh, 1, 1);
+
+        if (w) {
+            break;
+        }
+    }
+
+    printf(errors ? "FAIL\n" : "OK\n");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,47 @@
+/*
+ * tilemap.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Included in front of src/maps.c for sim/test/tilemap.c. Adds
+ * the background functions and registers the game logic does
+ * not need, so sim/include stays minimal.
+ */
+
+#ifndef __TILEMAP_H__
+#define __TILEMAP_H__
+
+#include <gbdk/platform.h>
+
+#define VBK_TILES 0
+#define VBK_ATTRIBUTES 1
+#define VBK_BANK_0 0
+#define VBK_BANK_1 1
+
+#define RGB(r, g, b) ((palette_color_t)((r) | ((g) << 5) | ((b) << 10)))
+#define RGB_WHITE RGB(31, 31, 31)
+
+void set_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles);
+void set_bkg_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles, uint8_t base);
+void set_win_based_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles, uint8_t base);
+void fill_bkg_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile);
+void fill_win_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile);
+void set_bkg_palette(uint8_t first, uint8_t count, const palette_color_t *colors);
+void move_bkg(uint8_t x, uint8_t y);
+
+#endif // __TILEMAP_H__
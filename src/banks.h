@@ -26,4 +26,17 @@
 #define START_ROM_BANK(x) uint8_t START_ROM_BANK_2(x)
 #define END_ROM_BANK while (0); SWITCH_ROM(__xyz_previous__bank);
 
+/*
+ * The per-frame code in HOT_SRCS (see Makefile) is pinned into
+ * HOT_BANK instead of being placed by autobank. Functions marked
+ * HOT are then plain calls instead of going through the banked
+ * call trampoline. So they must only be called from the hot bank.
+ * Other banks use the *_banked() wrappers.
+ */
+#ifdef HOT_BANK
+#define HOT
+#else
+#define HOT BANKED
+#endif
+
 #endif // __BANKS_H__
@@ -0,0 +1,103 @@
+/*
+ * bcd.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include "bcd.h"
+
+void bcd_add(struct bcd *a, uint8_t v) NONBANKED {
+    for (uint8_t i = 0; (i < BCD_BYTES) && (v != 0); i++) {
+        uint8_t lo = (a->d[i] & 0x0F) + (v & 0x0F);
+        uint8_t hi = (a->d[i] >> 4) + (v >> 4);
+        if (lo > 9) {
+            lo -= 10;
+            hi++;
+        }
+
+        v = 0;
+        if (hi > 9) {
+            hi -= 10;
+            v = 1;
+        }
+
+        a->d[i] = (hi << 4) | lo;
+    }
+}
+
+void bcd_sub(struct bcd *a, uint8_t v) NONBANKED {
+    for (uint8_t i = 0; (i < BCD_BYTES) && (v != 0); i++) {
+        int8_t lo = (a->d[i] & 0x0F) - (v & 0x0F);
+        int8_t hi = (a->d[i] >> 4) - (v >> 4);
+        if (lo < 0) {
+            lo += 10;
+            hi--;
+        }
+
+        v = 0;
+        if (hi < 0) {
+            hi += 10;
+            v = 1;
+        }
+
+        a->d[i] = (hi << 4) | lo;
+    }
+}
+
+void bcd_neg(struct bcd *a) NONBANKED {
+    // nines complement of every digit, plus one
+    for (uint8_t i = 0; i < BCD_BYTES; i++) {
+        a->d[i] = 0x99 - a->d[i];
+    }
+    bcd_add(a, 0x01);
+}
+
+int8_t bcd_sign(const struct bcd *a) NONBANKED {
+    if (a->d[BCD_BYTES - 1] >= 0x50) {
+        return -1;
+    }
+
+    for (uint8_t i = 0; i < BCD_BYTES; i++) {
+        if (a->d[i] != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int8_t bcd_cmp(const struct bcd *a, const struct bcd *b) NONBANKED {
+    uint8_t neg_a = a->d[BCD_BYTES - 1] >= 0x50;
+    uint8_t neg_b = b->d[BCD_BYTES - 1] >= 0x50;
+    if (neg_a != neg_b) {
+        return neg_a ? -1 : 1;
+    }
+
+    // with the same sign the digits compare like unsigned numbers
+    for (int8_t i = BCD_BYTES - 1; i >= 0; i--) {
+        if (a->d[i] != b->d[i]) {
+            return (a->d[i] < b->d[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+uint8_t bcd_len(const struct bcd *a) NONBANKED {
+    uint8_t len = BCD_DIGITS;
+    while ((len > 1) && (bcd_digit(a, len - 1) == 0)) {
+        len--;
+    }
+    return len;
+}
@@ -0,0 +1,59 @@
+/*
+ * bcd.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __BCD_H__
+#define __BCD_H__
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+/*
+ * Signed packed BCD numbers, two digits per byte, least
+ * significant byte first. Negative numbers are stored as
+ * their ten's complement, so adding and subtracting works
+ * the same for both signs and never needs a division.
+ * Digits can be read off the nibbles directly.
+ */
+
+#define BCD_BYTES 4
+#define BCD_DIGITS (BCD_BYTES * 2)
+
+struct bcd {
+    uint8_t d[BCD_BYTES];
+};
+
+// initializer for a constant, only for small literals
+#define BCD_VAL(n) ((n) < 0 ? (100000000L + (n)) : (n))
+#define BCD_BYTE(n, p) ((uint8_t)(((BCD_VAL(n) / (p)) % 10) | (((BCD_VAL(n) / ((p) * 10)) % 10) << 4)))
+#define BCD(n) { .d = { BCD_BYTE(n, 1L), BCD_BYTE(n, 100L), BCD_BYTE(n, 10000L), BCD_BYTE(n, 1000000L) } }
+
+// v is a packed BCD byte, 0x00 to 0x99
+void bcd_add(struct bcd *a, uint8_t v);
+void bcd_sub(struct bcd *a, uint8_t v);
+
+void bcd_neg(struct bcd *a);
+int8_t bcd_sign(const struct bcd *a);
+int8_t bcd_cmp(const struct bcd *a, const struct bcd *b);
+
+// number of digits without leading zeros, at least one
+uint8_t bcd_len(const struct bcd *a);
+
+#define bcd_digit(a, i) (((i) & 1) ? ((a)->d[(i) >> 1] >> 4) : ((a)->d[(i) >> 1] & 0x0F))
+
+#endif // __BCD_H__
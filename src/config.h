@@ -40,9 +40,12 @@ enum debug_flag {
     DBG_SHOW_FRAMES = (1U << 7),
     DBG_SHOW_TIMER  = (1U << 8),
     DBG_SHOW_STACK  = (1U << 9),
+    DBG_SHOW_PROF   = (1U << 10),
+    DBG_RECORD      = (1U << 11),
+    DBG_REPLAY      = (1U << 12),
 };
 
-#define DBG_OUT_ON (DBG_SHOW_FPS | DBG_SHOW_FRAMES | DBG_SHOW_TIMER | DBG_SHOW_STACK)
+#define DBG_OUT_ON (DBG_SHOW_FPS | DBG_SHOW_FRAMES | DBG_SHOW_TIMER | DBG_SHOW_STACK | DBG_SHOW_PROF)
 
 struct config {
     enum debug_flag debug_flags;
@@ -53,23 +56,45 @@ struct config {
     uint8_t dmg_bg_inv;
 };
 
-struct state {
+/*
+ * An interrupted game goes into one of two slots, always the
+ * one not holding the newest save. The commit byte is cleared
+ * first and only set again after the data and its CRC, so a
+ * save cut short by a power loss leaves the older slot in use.
+ */
+#define SAVE_SLOTS 2
+#define SAVE_COMMIT 0xC5
+
+struct save_slot {
+    uint8_t commit;
+    uint8_t seq; // newer slots count up, wrapping around
     uint8_t in_progress;
     struct game_state state_game;
-    struct obj_state state_obj;
+    uint8_t obj_cnt;
+    struct obj_saved objs[MAX_OBJ]; // only the first obj_cnt are used
+    uint32_t crc; // from seq up to the last used object
 };
 
 void conf_init(void) BANKED;
 void conf_write_crc(void) BANKED;
 
+uint8_t conf_state_saved(void) BANKED;
+void conf_state_load(void) BANKED;
+void conf_state_save(uint8_t in_progress) BANKED;
+
 BANKREF_EXTERN(config)
 
+// increase when the layout of config_mem changes, see conf_init()
+#define CONF_VERSION 1
+
 struct config_mem {
+    uint8_t version;
     struct config config;
     struct scores scores[SCORE_NUM * 2];
-    struct state state;
 
-    uint32_t crc; // needs to be last
+    uint32_t crc; // covers everything above
+
+    struct save_slot slots[SAVE_SLOTS]; // have their own CRC
 };
 
 extern struct config_mem mem;
@@ -77,6 +102,5 @@ extern uint16_t prng_seed;
 
 #define conf_get()    (&mem.config)
 #define conf_scores() (mem.scores)
-#define conf_state()  (&mem.state)
 
 #endif // __CONFIG_H__
@@ -21,6 +21,7 @@
 #include <string.h>
 #include <rand.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 #include "banks.h"
 #include "config.h"
@@ -28,6 +29,7 @@
 #include "obj.h"
 #include "sprites.h"
 #include "sound.h"
+#include "text.h"
 #include "input.h"
 #include "main.h"
 #include "sample.h"
@@ -36,6 +38,9 @@
 #include "table_speed_shot.h"
 #include "table_speed_move.h"
 #include "timer.h"
+#include "profile.h"
+#include "vram.h"
+#include "record.h"
 #include "game.h"
 
 #define BAR_OFFSET_X (4 - 80)
@@ -84,19 +89,83 @@ enum ACCELERATION {
 
 static uint8_t fps_count = 0;
 static uint16_t prev_fps_start = 0;
+static uint16_t prev_frame_time = 0;
 
 struct game_state game_state;
 uint16_t frame_count = 0;
 uint8_t game_fps = 0;
+uint16_t game_overruns = 0;
+
+/*
+ * The game advances in fixed steps of one LCD frame, measured
+ * with the 256Hz timer. Usually that is one step per rendered
+ * frame. After a frame took too long, the next one also runs
+ * the missed steps, without drawing them. Set STEP_MAX to 1 to
+ * go back to advancing once per rendered frame.
+ */
+#define STEP_LEN 4389 // TIMER_HZ / 59.73Hz, in 1/256th of a timer unit
+#define STEP_MAX 4
+
+#if STEP_MAX > REC_STEPS_MAX
+#error "STEP_MAX does not fit into a recording, see record.h"
+#endif
+
+static uint16_t prev_step_time = 0;
+static int16_t step_acc = 0;
+
+static void game_steps_reset(void) {
+    prev_step_time = timer_get();
+    step_acc = 0;
+}
+
+static uint8_t game_steps(void) {
+    uint16_t now = timer_get();
+    uint16_t diff = now - prev_step_time;
+    prev_step_time = now;
+
+    if (diff > ((STEP_MAX * STEP_LEN) >> 8)) {
+        diff = (STEP_MAX * STEP_LEN) >> 8;
+    }
+    step_acc += diff << 8;
+
+    uint8_t steps = 0;
+    do {
+        steps++;
+        step_acc -= STEP_LEN;
+    } while ((step_acc >= STEP_LEN) && (steps < STEP_MAX));
+
+    // the timer is coarser than a frame, so allow
+    // some jitter in both directions, but no more
+    if (step_acc >= STEP_LEN) {
+        step_acc = STEP_LEN - 1;
+    } else if (step_acc < -STEP_LEN) {
+        step_acc = -STEP_LEN;
+    }
+
+    if (rec_mode != REC_OFF) {
+        steps = rec_steps(steps);
+    }
+
+    return steps;
+}
 
 static void calc_fps(void) {
     frame_count++;
     fps_count++;
+
+    // more than one vblank since the last frame means we missed one
+    uint16_t vbls = sys_time - prev_frame_time;
+    prev_frame_time = sys_time;
+    if (vbls > 1) {
+        game_overruns += vbls - 1;
+    }
+
     uint16_t diff = timer_get() - prev_fps_start;
     if (diff >= TIMER_HZ) {
         prev_fps_start = timer_get();
         game_fps = fps_count;
         fps_count = 0;
+        prof_report();
     }
 }
 
@@ -118,13 +187,15 @@ static uint8_t pause_screen(void) {
         n = (n + 1) & (PAUSE_BLINK_FRAMES - 1);
 
         uint8_t hiwater = SPR_NUM_START;
+        spr_oam_begin();
         spr_draw(SPR_PAUSE, FLIP_NONE, 0, 0, (n < (PAUSE_BLINK_FRAMES / 2)) ? 0 : 1, &hiwater);
         hide_sprites_range(hiwater, MAX_HARDWARE_SPRITES);
+        spr_oam_commit();
 
         if (conf_get()->debug_flags & DBG_OUT_ON) {
-            uint8_t x_off = win_game_draw(game_state.score, 0);
-            move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
-                     MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
+            uint8_t x_off = win_game_draw(&game_state.score, 0);
+            vram_move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
+                          MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
         }
 
         calc_fps();
@@ -177,34 +248,156 @@ static void show_explosion(uint16_t power) {
 
     for (uint8_t n = 0; n < (4 * 4 * 4); n++) {
         uint8_t hiwater = SPR_NUM_START;
+        spr_oam_begin();
         status(0, power, &hiwater);
         if (n < (4 * 4)) {
             spr_draw(SPR_EXPL, FLIP_NONE, 0, 0, n >> 2, &hiwater);
         }
         hide_sprites_range(hiwater, MAX_HARDWARE_SPRITES);
+        spr_oam_commit();
         vsync();
     }
 }
 
-void game_get_mp_state(void) BANKED {
-    static struct mp_player_state mps;
+/*
+ * Versus mode. Both ships fly on the same wrapping 256x256
+ * field, so each side tracks its own position on it and sends
+ * that every frame. The other ship and its shots are drawn
+ * relative to ours. Each side only checks the hits on its own
+ * ship, the shots of the other one can not hit anything else.
+ */
+#define MP_POS_SCALE 5 // same fixed point as the objects
+#define MP_START_DIST 64 // pixels between the ships at the start
+#define MP_SHOTS 4
+#define MP_HIT_RANGE (10 << MP_POS_SCALE)
+#define MP_SHOT_DAMAGE (HEALTH_MAX / 8)
+
+// status bars, ship, markers, other ship and its shots
+#if (4 + 4 + 1 + 2 + 1 + MP_SHOTS) > SPR_GAME_EXTRA
+#error "a full frame does not fit into the sprite queue, see SPR_GAME_EXTRA"
+#endif
+
+struct mp_shot {
+    int16_t off_x, off_y;
+    int8_t spd_x, spd_y;
+    uint8_t travel; // MAX_TRAVEL when unused
+};
 
-    // TODO pass own pos to mp
+static uint16_t mp_pos_x = 0, mp_pos_y = 0;
+static uint16_t p2_pos_x = 0, p2_pos_y = 0;
+static struct mp_player_state p2;
+static uint8_t p2_seen = 0;
+static struct mp_shot mp_shots[MP_SHOTS];
+
+static int8_t mp_clamp(int16_t v) {
+    if (v > INT8_MAX) {
+        return INT8_MAX;
+    } else if (v < INT8_MIN) {
+        return INT8_MIN;
+    }
+    return v;
+}
 
-    // TODO scale?
-    mps.spd_x = game_state.spd_x;
-    mps.spd_y = game_state.spd_y;
+// wrap an offset to the playing field, like obj_do() does
+static int16_t mp_wrap(int16_t off) {
+    return (int16_t)(off << (8 - MP_POS_SCALE)) >> (8 - MP_POS_SCALE);
+}
 
+static void mp_init(void) {
+    mp_pos_x = mp_is_master ? 0 : (MP_START_DIST << MP_POS_SCALE);
+    mp_pos_y = 0;
+    p2_seen = 0;
+    for (uint8_t i = 0; i < MP_SHOTS; i++) {
+        mp_shots[i].travel = MAX_TRAVEL;
+    }
+}
+
+static void mp_send_state(uint8_t moving) {
+    static struct mp_player_state mps;
+
+    mps.pos_x = mp_pos_x >> MP_POS_SCALE;
+    mps.pos_y = mp_pos_y >> MP_POS_SCALE;
+    mps.spd_x = mp_clamp(game_state.spd_x);
+    mps.spd_y = mp_clamp(game_state.spd_y);
     mps.rot = game_state.rot;
+    mps.moving = moving;
+    mps.health = game_state.health >> HEALTH_SHIFT;
+    if ((mps.health == 0) && (game_state.health > 0)) {
+        mps.health = 1; // zero only once the ship exploded
+    }
     mp_new_state(&mps);
 }
 
+static void mp_send_shot(int16_t pos_x, int16_t pos_y, int16_t spd_x, int16_t spd_y) {
+    static struct mp_shot_state mss;
+
+    mss.pos_x = (mp_pos_x >> MP_POS_SCALE) + pos_x;
+    mss.pos_y = (mp_pos_y >> MP_POS_SCALE) + pos_y;
+    mss.spd_x = mp_clamp(spd_x);
+    mss.spd_y = mp_clamp(spd_y);
+    mp_add_shot(&mss);
+}
+
 void game_set_mp_player2(struct mp_player_state *state) BANKED {
-    // TODO update p2 pos
+    p2 = *state;
+    p2_pos_x = (uint16_t)state->pos_x << MP_POS_SCALE;
+    p2_pos_y = (uint16_t)state->pos_y << MP_POS_SCALE;
+    p2_seen = 1;
 }
 
 void game_set_mp_shot(struct mp_shot_state *state) BANKED {
-    // TODO add shot
+    for (uint8_t i = 0; i < MP_SHOTS; i++) {
+        struct mp_shot *s = &mp_shots[i];
+        if (s->travel < MAX_TRAVEL) {
+            continue;
+        }
+
+        s->off_x = (int16_t)(int8_t)(state->pos_x - (uint8_t)(mp_pos_x >> MP_POS_SCALE)) << MP_POS_SCALE;
+        s->off_y = (int16_t)(int8_t)(state->pos_y - (uint8_t)(mp_pos_y >> MP_POS_SCALE)) << MP_POS_SCALE;
+        s->spd_x = state->spd_x;
+        s->spd_y = state->spd_y;
+        s->travel = 0;
+        return;
+    }
+}
+
+// one step of the other ship and its shots, returns the damage taken
+static int16_t mp_step(uint8_t *hiwater) {
+    int16_t damage = 0;
+
+    mp_pos_x += game_state.spd_x;
+    mp_pos_y += game_state.spd_y;
+
+    for (uint8_t i = 0; i < MP_SHOTS; i++) {
+        struct mp_shot *s = &mp_shots[i];
+        if (s->travel >= MAX_TRAVEL) {
+            continue;
+        }
+
+        s->off_x = mp_wrap(s->off_x + s->spd_x - game_state.spd_x);
+        s->off_y = mp_wrap(s->off_y + s->spd_y - game_state.spd_y);
+        s->travel++;
+
+        if ((abs(s->off_x) <= MP_HIT_RANGE) && (abs(s->off_y) <= MP_HIT_RANGE)) {
+            damage += MP_SHOT_DAMAGE;
+            s->travel = MAX_TRAVEL;
+            continue;
+        }
+
+        spr_draw(SPR_SHOT_DARK, FLIP_NONE, s->off_x >> MP_POS_SCALE, s->off_y >> MP_POS_SCALE, 0, hiwater);
+    }
+
+    if (p2_seen && (p2.health > 0)) {
+        // keep it moving when a state went missing
+        p2_pos_x += p2.spd_x;
+        p2_pos_y += p2.spd_y;
+
+        spr_ship(p2.rot, p2.moving,
+                 (int8_t)((p2_pos_x - mp_pos_x) >> MP_POS_SCALE),
+                 (int8_t)((p2_pos_y - mp_pos_y) >> MP_POS_SCALE), hiwater);
+    }
+
+    return damage;
 }
 
 static void get_max_spd(int16_t *max_spd_x, int16_t *max_spd_y) NONBANKED {
@@ -227,18 +420,24 @@ void game_init(void) BANKED {
     game_state.rot = 0;
     game_state.health = HEALTH_MAX;
     game_state.power = POWER_MAX;
-    game_state.score = 0;
+    memset(&game_state.score, 0, sizeof(struct bcd));
     memset(&obj_state, 0, sizeof(struct obj_state));
 }
 
 uint8_t game(enum GAME_MODE mode) BANKED {
     snd_music_off();
     snd_note_off();
+    sample_reset();
+
+    HIDE_SPRITES;
+    HIDE_WIN;
+    struct map_job *job = map_load_begin(0);
+    do {
+        vsync();
+    } while (map_load_step(job));
 
     disable_interrupts();
-    DISPLAY_OFF;
-    map_load(0);
-    map_fill(MAP_GAME_1 + conf_get()->game_bg, 1);
+    map_game(MAP_GAME_1 + conf_get()->game_bg);
     SHOW_BKG;
     spr_init_pal();
     SHOW_SPRITES;
@@ -247,33 +446,47 @@ uint8_t game(enum GAME_MODE mode) BANKED {
     frame_count = 0;
     fps_count = 0;
     prev_fps_start = 0;
+    game_overruns = 0;
+    prof_reset((conf_get()->debug_flags & DBG_SHOW_PROF) ? 1 : 0);
 
     if (mode == GM_SINGLE) {
         if (!(conf_get()->debug_flags & DBG_NO_OBJ)) {
             obj_spawn();
         }
+    } else {
+        mp_init();
     }
 
-    uint8_t x_off = win_game_draw(game_state.score, 1);
-    move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
-             MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
+    // set while the window is behind, when the VRAM queue was full
+    uint8_t x_off = win_game_draw(&game_state.score, 1);
+    uint8_t win_pending = number_cached_pending()
+            || !vram_move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
+                              MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
 
     SHOW_WIN;
-    DISPLAY_ON;
+    map_load_show(job);
     enable_interrupts();
 
     snd_music(SND_GAME);
 
     uint8_t return_value = 0xFF;
+    prev_frame_time = sys_time;
+    game_steps_reset();
     while(1) {
+        prof_start();
         key_read();
+        sample_update();
 
         if (mode != GM_SINGLE) {
-            mp_handle();
+            // the other side left, lost the link or exploded
+            if ((!mp_handle()) || (p2_seen && (p2.health == 0))) {
+                return_value = 1;
+                break;
+            }
         }
 
         enum ACCELERATION acc = 0;
-        int32_t prev_score = game_state.score;
+        struct bcd prev_score = game_state.score;
 
         if (key_pressed(J_LEFT)) {
             game_state.rot = (game_state.rot - 1) & (ROT_INVALID - 1);
@@ -283,94 +496,6 @@ uint8_t game(enum GAME_MODE mode) BANKED {
             acc |= ACC_R;
         }
 
-        if (key_down(J_A) && (game_state.power > 0)) {
-            int16_t max_spd_x;
-            int16_t max_spd_y;
-            get_max_spd(&max_spd_x, &max_spd_y);
-
-            if (conf_get()->debug_flags & DBG_FAST) {
-                if (max_spd_x > 0) {
-                    max_spd_x = SPEED_MAX_DBG;
-                } else if (max_spd_x < 0) {
-                    max_spd_x = -SPEED_MAX_DBG;
-                }
-
-                if (max_spd_y > 0) {
-                    max_spd_y = SPEED_MAX_DBG;
-                } else if (max_spd_y < 0) {
-                    max_spd_y = -SPEED_MAX_DBG;
-                }
-            }
-
-            if (max_spd_x != 0) {
-                if (max_spd_x > 0) {
-                    game_state.spd_x += SPEED_INC;
-                    if (game_state.spd_x > max_spd_x) {
-                        game_state.spd_x = max_spd_x;
-                    }
-                } else {
-                    game_state.spd_x -= SPEED_INC;
-                    if (game_state.spd_x < max_spd_x) {
-                        game_state.spd_x = max_spd_x;
-                    }
-                }
-
-                acc |= ACC_X;
-            }
-
-            if (max_spd_y != 0) {
-                if (max_spd_y > 0) {
-                    game_state.spd_y += SPEED_INC;
-                    if (game_state.spd_y > max_spd_y) {
-                        game_state.spd_y = max_spd_y;
-                    }
-                } else {
-                    game_state.spd_y -= SPEED_INC;
-                    if (game_state.spd_y < max_spd_y) {
-                        game_state.spd_y = max_spd_y;
-                    }
-                }
-
-                acc |= ACC_Y;
-            }
-
-            if (!(conf_get()->debug_flags & DBG_NO_FUEL)) {
-                if (game_state.power >= POWER_DEC) {
-                    game_state.power -= POWER_DEC;
-                } else {
-                    game_state.power = 0;
-                }
-            }
-        } else if (!key_down(J_A) && (game_state.power < POWER_MAX)) {
-            if (game_state.power <= (POWER_MAX - POWER_INC)) {
-                game_state.power += POWER_INC;
-            } else {
-                game_state.power = POWER_MAX;
-            }
-        }
-
-        // adjust speed down when not moving
-        if (!(acc & ACC_X)) {
-            if (game_state.spd_x != 0) {
-                if (!(conf_get()->debug_flags & DBG_FAST)) {
-                    if (game_state.spd_x > SPEED_MAX_IDLE) game_state.spd_x -= SPEED_DEC;
-                    else if (game_state.spd_x < -SPEED_MAX_IDLE) game_state.spd_x += SPEED_DEC;
-                } else {
-                    game_state.spd_x = 0;
-                }
-            }
-        }
-        if (!(acc & ACC_Y)) {
-            if (game_state.spd_y != 0) {
-                if (!(conf_get()->debug_flags & DBG_FAST)) {
-                    if (game_state.spd_y > SPEED_MAX_IDLE) game_state.spd_y -= SPEED_DEC;
-                    else if (game_state.spd_y < -SPEED_MAX_IDLE) game_state.spd_y += SPEED_DEC;
-                } else {
-                    game_state.spd_y = 0;
-                }
-            }
-        }
-
         if (key_pressed(J_B)) {
             int16_t shot_spd_x;
             int16_t shot_spd_y;
@@ -389,94 +514,208 @@ uint8_t game(enum GAME_MODE mode) BANKED {
                 sample_play(SFX_SHOT);
 
                 if (mode == GM_SINGLE) {
-                    if (game_state.score > 0) {
-                        game_state.score--;
+                    if (bcd_sign(&game_state.score) > 0) {
+                        bcd_sub(&game_state.score, 0x01);
                     }
                 } else {
-                    static struct mp_shot_state state;
-
-                    // TODO send absolute coordinate
-                    state.pos_x = shot_pos_x;
-                    state.pos_y = shot_pos_y;
-
-                    // TODO scale?
-                    state.spd_x = shot_spd_x;
-                    state.spd_y = shot_spd_y;
-
-                    mp_add_shot(&state);
+                    mp_send_shot(shot_pos_x, shot_pos_y, shot_spd_x, shot_spd_y);
                 }
             }
         }
 
         if (key_pressed(J_START)) {
-            if (pause_screen()) {
+            // there is no pausing the other side, so leave instead
+            if ((mode != GM_SINGLE) || pause_screen()) {
                 return_value = 1;
                 break;
             }
 
             // restart bg music
             snd_music(SND_GAME);
+
+            // don't catch up on the time spent in the pause menu
+            game_steps_reset();
         }
 
         if (key_pressed(J_SELECT) && conf_get()->debug_flags) {
             map_dbg_reset();
         }
 
-        map_move(game_state.spd_x, game_state.spd_y);
-
         uint8_t hiwater = SPR_NUM_START;
-        status(game_state.health >> HEALTH_SHIFT, game_state.power >> POWER_SHIFT, &hiwater);
+        uint8_t steps = game_steps();
+        spr_oam_begin();
+
+        for (uint8_t step = 0; step < steps; step++) {
+            acc &= ~(ACC_X | ACC_Y);
+
+            if (key_down(J_A) && (game_state.power > 0)) {
+                int16_t max_spd_x;
+                int16_t max_spd_y;
+                get_max_spd(&max_spd_x, &max_spd_y);
+
+                if (conf_get()->debug_flags & DBG_FAST) {
+                    if (max_spd_x > 0) {
+                        max_spd_x = SPEED_MAX_DBG;
+                    } else if (max_spd_x < 0) {
+                        max_spd_x = -SPEED_MAX_DBG;
+                    }
 
-        if (conf_get()->debug_flags & DBG_MARKER) {
-            spr_draw(SPR_DEBUG, FLIP_NONE, 0, 0, 0, &hiwater);
-            spr_draw(SPR_DEBUG_LARGE, FLIP_NONE, 0, 0, 0, &hiwater);
-        }
+                    if (max_spd_y > 0) {
+                        max_spd_y = SPEED_MAX_DBG;
+                    } else if (max_spd_y < 0) {
+                        max_spd_y = -SPEED_MAX_DBG;
+                    }
+                }
 
-        spr_ship(game_state.rot, acc & (ACC_X | ACC_Y), &hiwater);
+                if (max_spd_x != 0) {
+                    if (max_spd_x > 0) {
+                        game_state.spd_x += SPEED_INC;
+                        if (game_state.spd_x > max_spd_x) {
+                            game_state.spd_x = max_spd_x;
+                        }
+                    } else {
+                        game_state.spd_x -= SPEED_INC;
+                        if (game_state.spd_x < max_spd_x) {
+                            game_state.spd_x = max_spd_x;
+                        }
+                    }
+
+                    acc |= ACC_X;
+                }
 
-        int16_t damage = obj_do(&game_state.spd_x, &game_state.spd_y, &game_state.score, &hiwater,
-                                (conf_get()->debug_flags & DBG_NO_OBJ) ? 1 : 0);
-        if (damage > 0) {
-            if (conf_get()->debug_flags & DBG_GOD_MODE) {
-                damage = 0;
+                if (max_spd_y != 0) {
+                    if (max_spd_y > 0) {
+                        game_state.spd_y += SPEED_INC;
+                        if (game_state.spd_y > max_spd_y) {
+                            game_state.spd_y = max_spd_y;
+                        }
+                    } else {
+                        game_state.spd_y -= SPEED_INC;
+                        if (game_state.spd_y < max_spd_y) {
+                            game_state.spd_y = max_spd_y;
+                        }
+                    }
+
+                    acc |= ACC_Y;
+                }
+
+                if (!(conf_get()->debug_flags & DBG_NO_FUEL)) {
+                    if (game_state.power >= POWER_DEC) {
+                        game_state.power -= POWER_DEC;
+                    } else {
+                        game_state.power = 0;
+                    }
+                }
+            } else if (!key_down(J_A) && (game_state.power < POWER_MAX)) {
+                if (game_state.power <= (POWER_MAX - POWER_INC)) {
+                    game_state.power += POWER_INC;
+                } else {
+                    game_state.power = POWER_MAX;
+                }
             }
 
-            if (game_state.health > damage) {
-                game_state.health -= damage;
-                if ((!sample_running()) && (sample_last() != SFX_DAMAGE)) {
-                    sample_play(SFX_DAMAGE);
+            // adjust speed down when not moving
+            if (!(acc & ACC_X)) {
+                if (game_state.spd_x != 0) {
+                    if (!(conf_get()->debug_flags & DBG_FAST)) {
+                        if (game_state.spd_x > SPEED_MAX_IDLE) game_state.spd_x -= SPEED_DEC;
+                        else if (game_state.spd_x < -SPEED_MAX_IDLE) game_state.spd_x += SPEED_DEC;
+                    } else {
+                        game_state.spd_x = 0;
+                    }
                 }
-            } else if (game_state.health <= damage) {
-                game_state.health = 0;
-                show_explosion(game_state.power);
-                return_value = 0;
-                break;
             }
-        } else if ((damage < 0) && (game_state.health < HEALTH_MAX)) {
-            if ((!sample_running()) && (sample_last() != SFX_HEAL)) {
-                sample_play(SFX_HEAL);
+            if (!(acc & ACC_Y)) {
+                if (game_state.spd_y != 0) {
+                    if (!(conf_get()->debug_flags & DBG_FAST)) {
+                        if (game_state.spd_y > SPEED_MAX_IDLE) game_state.spd_y -= SPEED_DEC;
+                        else if (game_state.spd_y < -SPEED_MAX_IDLE) game_state.spd_y += SPEED_DEC;
+                    } else {
+                        game_state.spd_y = 0;
+                    }
+                }
+            }
+
+            prof_mark(PROF_INPUT);
+
+            map_move(game_state.spd_x, game_state.spd_y);
+            prof_mark(PROF_MAP);
+
+            // only the sprites of the last step end up on screen
+            spr_sched_begin();
+            status(game_state.health >> HEALTH_SHIFT, game_state.power >> POWER_SHIFT, &hiwater);
+            prof_mark(PROF_STATUS);
+
+            if (conf_get()->debug_flags & DBG_MARKER) {
+                spr_draw(SPR_DEBUG, FLIP_NONE, 0, 0, 0, &hiwater);
+                spr_draw(SPR_DEBUG_LARGE, FLIP_NONE, 0, 0, 0, &hiwater);
             }
 
-            game_state.health += -damage;
-            if (game_state.health > HEALTH_MAX) {
-                game_state.health = HEALTH_MAX;
+            spr_ship(game_state.rot, acc & (ACC_X | ACC_Y), 0, 0, &hiwater);
+            prof_mark(PROF_SHIP);
+
+            int16_t damage = obj_do(&game_state.spd_x, &game_state.spd_y, &game_state.score, &hiwater,
+                                    (conf_get()->debug_flags & DBG_NO_OBJ) ? 1 : 0);
+            if (mode != GM_SINGLE) {
+                damage += mp_step(&hiwater);
             }
-        } else if (damage == 0) {
-            sample_last_reset();
+            if (damage > 0) {
+                if (conf_get()->debug_flags & DBG_GOD_MODE) {
+                    damage = 0;
+                }
+
+                if (game_state.health > damage) {
+                    game_state.health -= damage;
+                    sample_play(SFX_DAMAGE);
+                } else if (game_state.health <= damage) {
+                    game_state.health = 0;
+                    return_value = 0;
+                    break;
+                }
+            } else if ((damage < 0) && (game_state.health < HEALTH_MAX)) {
+                sample_play(SFX_HEAL);
+
+                game_state.health += -damage;
+                if (game_state.health > HEALTH_MAX) {
+                    game_state.health = HEALTH_MAX;
+                }
+            }
+            prof_mark(PROF_OBJ);
         }
 
+        spr_sched_end(&hiwater);
         hide_sprites_range(hiwater, MAX_HARDWARE_SPRITES);
+        spr_oam_commit();
+        prof_mark(PROF_OBJ);
+
+        if (mode != GM_SINGLE) {
+            mp_send_state(acc & (ACC_X | ACC_Y));
+        }
 
-        if ((game_state.score != prev_score)
+        if (return_value == 0) {
+            show_explosion(game_state.power);
+            break;
+        }
+
+        if (win_pending || (bcd_cmp(&game_state.score, &prev_score) != 0)
                 || (conf_get()->debug_flags & DBG_OUT_ON)) {
-            uint8_t x_off = win_game_draw(game_state.score, 0);
-            move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
-                     MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
+            uint8_t x_off = win_game_draw(&game_state.score, 0);
+            win_pending = number_cached_pending()
+                    || !vram_move_win(MINWNDPOSX + DEVICE_SCREEN_PX_WIDTH - x_off,
+                                      MINWNDPOSY + DEVICE_SCREEN_PX_HEIGHT - 16);
         }
+        prof_mark(PROF_WIN);
+        prof_frame_done();
 
         calc_fps();
         vsync();
     }
 
+    // the menus write VRAM directly again
+    vram_flush();
+    spr_oam_reset();
+
+    // nothing calls sample_update() outside of the game
+    sample_reset();
     return return_value;
 }
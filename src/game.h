@@ -23,6 +23,7 @@
 #include <gbdk/platform.h>
 #include <stdint.h>
 
+#include "bcd.h"
 #include "multiplayer.h"
 #include "sprites.h"
 
@@ -38,6 +39,16 @@ enum GAME_MODE {
 };
 
 struct game_state {
+    int16_t spd_x;
+    int16_t spd_y;
+    enum SPRITE_ROT rot;
+    uint16_t health;
+    uint16_t power;
+    struct bcd score;
+};
+
+// save state layout of version 0, only used for conversion
+struct game_state_v0 {
     int16_t spd_x;
     int16_t spd_y;
     enum SPRITE_ROT rot;
@@ -46,7 +57,6 @@ struct game_state {
     int32_t score;
 };
 
-void game_get_mp_state(void) BANKED;
 void game_set_mp_player2(struct mp_player_state *state) BANKED;
 void game_set_mp_shot(struct mp_shot_state *state) BANKED;
 
@@ -56,6 +66,7 @@ uint8_t game(enum GAME_MODE mode) BANKED;
 extern struct game_state game_state;
 extern uint16_t frame_count;
 extern uint8_t game_fps;
+extern uint16_t game_overruns;
 
 BANKREF_EXTERN(game)
 
@@ -21,6 +21,7 @@
 
 #include "banks.h"
 #include "input.h"
+#include "record.h"
 
 static uint8_t joyp = 0;
 static uint8_t old_joyp = 0;
@@ -39,6 +40,9 @@ static const uint8_t key_debug_sequence[] = {
 void key_read(void) NONBANKED {
     old_joyp = joyp;
     joyp = joypad();
+    if (rec_mode != REC_OFF) {
+        joyp = rec_key(joyp);
+    }
 
     if (debug_cnt < DEBUG_SEQUENCE_COUNT) {
         START_ROM_BANK(BANK(input)) {
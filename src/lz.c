@@ -0,0 +1,131 @@
+/*
+ * lz.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include <gbdk/emu_debug.h>
+
+#include "lz.h"
+
+#define LZ_TILE_SIZE 16
+
+// DIV counts at 16kHz, twice that in CGB double speed
+#define LZ_DIV_PER_FRAME 274
+#define LZ_DIV_PER_FRAME_CGB 549
+
+static uint8_t ring[256];
+static uint8_t pos, from, lit, copy;
+static const uint8_t *src;
+static uint8_t src_bank;
+
+#ifdef DEBUG
+// load time of everything since the last report
+static uint16_t tiles = 0;
+static uint32_t ticks = 0;
+#endif // DEBUG
+
+void lz_begin(const uint8_t *data, uint8_t bank) NONBANKED {
+    src = data;
+    src_bank = bank;
+    pos = 0;
+    lit = 0;
+    copy = 0;
+}
+
+// called with src_bank mapped
+static uint8_t lz_byte(void) NONBANKED {
+    uint8_t b;
+
+    if (copy) {
+        copy--;
+        b = ring[from++];
+    } else if (lit) {
+        lit--;
+        b = *(src++);
+    } else {
+        uint8_t c = *(src++);
+        if (c & 0x80) {
+            copy = (c & 0x7F) + LZ_MIN_MATCH - 1;
+            from = pos - *(src++) - 1;
+            b = ring[from++];
+        } else {
+            lit = c;
+            b = *(src++);
+        }
+    }
+
+    ring[pos++] = b;
+    return b;
+}
+
+// the ring holds whole tiles, they start at multiples of 16
+static const uint8_t *lz_tile(void) NONBANKED {
+    for (uint8_t i = 0; i < LZ_TILE_SIZE; i++) {
+        lz_byte();
+    }
+    return ring + (uint8_t)(pos - LZ_TILE_SIZE);
+}
+
+void lz_bkg_data(uint8_t first, uint16_t count) NONBANKED {
+#ifdef DEBUG
+    uint8_t div = DIV_REG;
+#endif // DEBUG
+
+    START_ROM_BANK(src_bank) {
+        for (; count > 0; count--) {
+            set_bkg_data(first++, 1, lz_tile());
+
+#ifdef DEBUG
+            ticks += (uint8_t)(DIV_REG - div);
+            div = DIV_REG;
+            tiles++;
+#endif // DEBUG
+        }
+    } END_ROM_BANK
+}
+
+void lz_sprite_data(uint8_t first, uint8_t count) NONBANKED {
+#ifdef DEBUG
+    uint8_t div = DIV_REG;
+#endif // DEBUG
+
+    START_ROM_BANK(src_bank) {
+        for (; count > 0; count--) {
+            set_sprite_data(first++, 1, lz_tile());
+
+#ifdef DEBUG
+            ticks += (uint8_t)(DIV_REG - div);
+            div = DIV_REG;
+            tiles++;
+#endif // DEBUG
+        }
+    } END_ROM_BANK
+}
+
+// only prints with DEBUG set, otherwise nothing is counted
+void lz_report(void) BANKED {
+#ifdef DEBUG
+    uint16_t per_frame = (_cpu == CGB_TYPE) ? LZ_DIV_PER_FRAME_CGB : LZ_DIV_PER_FRAME;
+    uint16_t frames_100 = (ticks * 100) / per_frame;
+
+    EMU_printf("%s: %u tiles in %u.%02u frames\n", __func__,
+               tiles, frames_100 / 100, frames_100 % 100);
+
+    tiles = 0;
+    ticks = 0;
+#endif // DEBUG
+}
@@ -0,0 +1,47 @@
+/*
+ * lz.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LZ_H__
+#define __LZ_H__
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+/*
+ * Unpacks tile data compressed by util/lzcomp.py straight into
+ * VRAM. It is byte oriented, with a window of 256 bytes, so it
+ * only needs a small ring buffer and 8 bit arithmetic:
+ *
+ * 0b0nnnnnnn: n + 1 literal bytes follow
+ * 0b1nnnnnnn: copy n + LZ_MIN_MATCH bytes, from offset + 1
+ *             bytes back, the offset byte follows
+ *
+ * lz_begin() starts a stream, which is unpacked one 16 byte
+ * tile at a time. Consecutive calls continue the same stream.
+ */
+
+#define LZ_MIN_MATCH 3
+
+void lz_begin(const uint8_t *data, uint8_t bank);
+void lz_bkg_data(uint8_t first, uint16_t count);
+void lz_sprite_data(uint8_t first, uint8_t count);
+
+void lz_report(void) BANKED;
+
+#endif // __LZ_H__
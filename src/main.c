@@ -39,12 +39,19 @@
 #include "border_sgb.h"
 #include "timer.h"
 #include "sample.h"
+#include "text.h"
+#include "vram.h"
 #include "window.h"
 #include "gbprinter.h"
 #include "multiplayer.h"
+#include "record.h"
 #include "table_speed_shot.h"
 #include "main.h"
 
+#ifdef BENCH
+#include "bench.h"
+#endif // BENCH
+
 //#define CONSTANT_SEED 42
 
 uint8_t debug_menu_index = 0;
@@ -73,12 +80,16 @@ const struct debug_entry debug_entries[DEBUG_ENTRY_COUNT] = {
     { .name = "s-frames", .flag = DBG_SHOW_FRAMES, .max = 1         }, // 6
     { .name = "sh-timer", .flag = DBG_SHOW_TIMER,  .max = 1         }, // 7
     { .name = "sh-stack", .flag = DBG_SHOW_STACK,  .max = 1         }, // 8
+    { .name = "profiler", .flag = DBG_SHOW_PROF,   .max = 1         }, // 9
+    { .name = "record",   .flag = DBG_RECORD,      .max = 1         }, // 10
+    { .name = "replay",   .flag = DBG_REPLAY,      .max = 1         }, // 11
 
     // keep at end
-    { .name = "music",    .flag = DBG_NONE,        .max = SND_COUNT }, // 9
-    { .name = "sfx-test", .flag = DBG_NONE,        .max = SFX_COUNT }, // 10
-    { .name = "cl score", .flag = DBG_NONE,        .max = 1         }, // 11
-    { .name = "0 scores", .flag = DBG_NONE,        .max = 1         }, // 12
+    { .name = "obj-tier", .flag = DBG_NONE,        .max = OBJ_TIER_COUNT - 1 }, // 12
+    { .name = "music",    .flag = DBG_NONE,        .max = SND_COUNT }, // 13
+    { .name = "sfx-test", .flag = DBG_NONE,        .max = SFX_COUNT }, // 14
+    { .name = "cl score", .flag = DBG_NONE,        .max = 1         }, // 15
+    { .name = "0 scores", .flag = DBG_NONE,        .max = 1         }, // 16
 };
 
 #define DEBUG_MENU_MUSIC_INDEX (DEBUG_ENTRY_COUNT - 4)
@@ -214,6 +225,7 @@ static void conf_screen(void) {
                 *conf_entries[debug_menu_index].var = conf_entries[debug_menu_index].max;
             }
             win_conf();
+            snd_volume();
             changed = 1;
         } else if (key_pressed(J_RIGHT)) {
             if (*conf_entries[debug_menu_index].var < conf_entries[debug_menu_index].max) {
@@ -222,6 +234,7 @@ static void conf_screen(void) {
                 *conf_entries[debug_menu_index].var = 0;
             }
             win_conf();
+            snd_volume();
             changed = 1;
         } else if (key_pressed(J_A) || key_pressed(J_B) || key_pressed(J_START)) {
             break;
@@ -245,15 +258,11 @@ static void splash_win(void) {
         move_win(MINWNDPOSX, MINWNDPOSY);
     } else {
         // initially show the top 1 scores
-        struct scores score;
-
-        score_lowest(0, &score);
-        int32_t low = score.score;
+        struct scores low, high;
+        score_lowest(0, &low);
+        score_highest(0, &high);
 
-        score_highest(0, &score);
-        int32_t high = score.score;
-
-        win_splash_draw(-low, high);
+        win_splash_draw(&low.score, &high.score);
 
         move_win(MINWNDPOSX, MINWNDPOSY);
     }
@@ -271,8 +280,8 @@ static void splash_anim(uint8_t *hiwater) NONBANKED {
 
     int16_t spd_off_x = 0;
     int16_t spd_off_y = 0;
-    int32_t score = 0;
-    obj_do(&spd_off_x, &spd_off_y, &score, hiwater, 1);
+    struct bcd score = BCD(0);
+    obj_do_banked(&spd_off_x, &spd_off_y, &score, hiwater, 1);
 
     /*
      * 0: right
@@ -293,11 +302,11 @@ static void splash_anim(uint8_t *hiwater) NONBANKED {
         case 1:
             if (anim_frame == 0) {
                 START_ROM_BANK(BANK(table_speed_shot)) {
-                    obj_add(SPR_SHOT, SHIP_OFF, -42,
+                    obj_add_banked(SPR_SHOT, SHIP_OFF, -42,
                             table_speed_shot[(ROT_90 * table_speed_shot_WIDTH) + 0],
                             -table_speed_shot[(ROT_90 * table_speed_shot_WIDTH) + 1]);
                 } END_ROM_BANK;
-                sample_play(SFX_SHOT);
+                sample_play_banked(SFX_SHOT);
             }
         case 0:
         case 2:
@@ -306,7 +315,7 @@ static void splash_anim(uint8_t *hiwater) NONBANKED {
 
         case 3:
             if (anim_frame == 30) {
-                obj_add(SPR_LIGHT, 42, -42, 0, 0);
+                obj_add_banked(SPR_LIGHT, 42, -42, 0, 0);
             }
         case 11:
             spr_draw(SPR_SHIP, FLIP_NONE, 1, -42 - 1, 2, hiwater);
@@ -314,7 +323,7 @@ static void splash_anim(uint8_t *hiwater) NONBANKED {
 
         case 9:
             if (anim_frame == 30) {
-                obj_add(SPR_DARK, -42, -42, 0, 0);
+                obj_add_banked(SPR_DARK, -42, -42, 0, 0);
             }
         case 5:
             spr_draw(SPR_SHIP, FLIP_X, -1, -42 - 1, 2, hiwater);
@@ -328,11 +337,11 @@ static void splash_anim(uint8_t *hiwater) NONBANKED {
         case 7:
             if (anim_frame == 0) {
                 START_ROM_BANK(BANK(table_speed_shot)) {
-                    obj_add(SPR_SHOT, -SHIP_OFF, -42,
+                    obj_add_banked(SPR_SHOT, -SHIP_OFF, -42,
                             table_speed_shot[(ROT_270 * table_speed_shot_WIDTH) + 0],
                             -table_speed_shot[(ROT_270 * table_speed_shot_WIDTH) + 1]);
                 } END_ROM_BANK;
-                sample_play(SFX_SHOT);
+                sample_play_banked(SFX_SHOT);
             }
         case 6:
         case 8:
@@ -345,9 +354,14 @@ void splash(void) BANKED {
     snd_music_off();
     snd_note_off();
 
+    HIDE_SPRITES;
+    HIDE_WIN;
+    struct map_job *job = map_load_begin(1);
+    do {
+        vsync();
+    } while (map_load_step(job));
+
     disable_interrupts();
-    DISPLAY_OFF;
-    map_load(1);
     map_fill(MAP_TITLE, 1);
     SHOW_BKG;
     spr_init_pal();
@@ -358,12 +372,12 @@ void splash(void) BANKED {
     anim_state = 0;
 
     memset(&obj_state, 0, sizeof(struct obj_state));
-    obj_add(SPR_LIGHT, 42, -42, 0, 0);
-    obj_add(SPR_DARK, -42, -42, 0, 0);
+    obj_add_banked(SPR_LIGHT, 42, -42, 0, 0);
+    obj_add_banked(SPR_DARK, -42, -42, 0, 0);
 
     splash_win();
 
-    DISPLAY_ON;
+    map_load_show(job);
     enable_interrupts();
 
     if (!(conf_get()->debug_flags & DBG_MENU)) {
@@ -456,16 +470,19 @@ void splash(void) BANKED {
                     snd_music(SND_MENU);
                 }
 
-                if (switch_special && (debug_menu_index == DEBUG_MENU_MUSIC_INDEX)) {
+                if (switch_special && (debug_menu_index == DEBUG_MENU_TIER_INDEX)) {
+                    // only two tiers, so both directions just toggle
+                    obj_set_tier((obj_get_tier() + 1) % OBJ_TIER_COUNT);
+                } else if (switch_special && (debug_menu_index == DEBUG_MENU_MUSIC_INDEX)) {
                     snd_music_off();
                     if (debug_special_value > 0) {
                         snd_music(debug_special_value - 1);
                     }
                     snd_note_off();
-                } else if ((switch_special || (!sample_running()))
+                } else if ((switch_special || (!sample_running_banked()))
                         && (debug_menu_index == DEBUG_MENU_SFX_INDEX)) {
                     if (debug_special_value > 0) {
-                        sample_play(debug_special_value - 1);
+                        sample_play_banked(debug_special_value - 1);
                     }
                 } else if (switch_special && debug_special_value
                         && (debug_menu_index == DEBUG_MENU_CLEAR_INDEX)) {
@@ -510,13 +527,19 @@ void splash(void) BANKED {
     }
 }
 
-uint16_t ask_name(int32_t score) BANKED {
+uint16_t ask_name(const struct bcd *score) BANKED {
+    uint8_t is_black = (bcd_sign(score) < 0) ? 1 : 0;
+
     snd_music_off();
     snd_note_off();
 
+    HIDE_SPRITES;
+    struct map_job *job = map_load_begin(1);
+    do {
+        vsync();
+    } while (map_load_step(job));
+
     disable_interrupts();
-    DISPLAY_OFF;
-    map_load(1);
     map_fill(MAP_TITLE, 0);
     SHOW_BKG;
     spr_init_pal();
@@ -530,14 +553,14 @@ uint16_t ask_name(int32_t score) BANKED {
     move_win(MINWNDPOSX, MINWNDPOSY);
     SHOW_WIN;
 
-    DISPLAY_ON;
+    map_load_show(job);
     enable_interrupts();
 
     snd_music(SND_GAMEOVER);
 
     char name[3] = { 'a', 'a', 'a' };
     uint8_t pos = 0;
-    win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+    win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
 
     while (1) {
         key_read();
@@ -545,12 +568,12 @@ uint16_t ask_name(int32_t score) BANKED {
         if (key_pressed(J_LEFT)) {
             if (pos > 0) {
                 pos--;
-                win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+                win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
             }
         } else if (key_pressed(J_RIGHT)) {
             if (pos < 3) {
                 pos++;
-                win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+                win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
             }
         } else if (key_pressed(J_UP)) {
             if (pos < 3) {
@@ -558,7 +581,7 @@ uint16_t ask_name(int32_t score) BANKED {
                 if (name[pos] > 'z') {
                     name[pos] -= 'z' - 'a' + 1;
                 }
-                win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+                win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
             }
         } else if (key_pressed(J_DOWN)) {
             if (pos < 3) {
@@ -566,12 +589,12 @@ uint16_t ask_name(int32_t score) BANKED {
                 if (name[pos] < 'a') {
                     name[pos] += 'z' - 'a' + 1;
                 }
-                win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+                win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
             }
         } else if (key_pressed(J_A)) {
             if (pos < 3) {
                 pos++;
-                win_name_draw(convert_name(name[0], name[1], name[2]), score < 0, pos);
+                win_name_draw(convert_name(name[0], name[1], name[2]), is_black, pos);
             } else {
                 break;
             }
@@ -631,7 +654,7 @@ static void sgb_init(void) NONBANKED {
     }
 
     START_ROM_BANK(BANK(border_sgb)) {
-        set_sgb_border((const uint8_t *)border_sgb_tiles, sizeof(border_sgb_tiles),
+        set_sgb_border((const uint8_t *)border_sgb_tiles, border_sgb_TILES_RAW_SIZE,
                        (const uint8_t *)border_sgb_map, sizeof(border_sgb_map),
                        (const uint8_t *)border_sgb_palettes, sizeof(border_sgb_palettes));
     } END_ROM_BANK
@@ -648,6 +671,9 @@ void main(void) NONBANKED {
         cpu_fast();
     }
 
+    // and use the spare time for more objects
+    obj_set_tier((get_hw() == HW_GBC) ? OBJ_TIER_GBC : OBJ_TIER_DMG);
+
     DISPLAY_OFF;
     map_load(1);
     map_fill(MAP_TITLE, 1);
@@ -655,7 +681,13 @@ void main(void) NONBANKED {
     DISPLAY_ON;
 
     conf_init();
+
+#ifdef BENCH
+    bench(); // does not return
+#endif // BENCH
+
     timer_init();
+    vram_init();
     spr_init();
     snd_init();
 
@@ -676,28 +708,33 @@ void main(void) NONBANKED {
     initarand(prng_seed);
 
     while (1) {
-        if (conf_state()->in_progress && ask_continue()) {
-            game_state = conf_state()->state_game;
-            obj_state = conf_state()->state_obj;
+        // recordings always start with a fresh game and a known seed
+        uint8_t recording = (conf_get()->debug_flags & (DBG_RECORD | DBG_REPLAY)) != 0;
+
+        if ((!recording) && conf_state_saved() && ask_continue()) {
+            conf_state_load();
         } else {
+            if (recording) {
+                prng_seed = rec_start(((uint16_t)arand() << 8) | arand());
+                initarand(prng_seed);
+            }
             game_init();
         }
 
-        if (game(GM_SINGLE)) {
+        uint8_t paused = game(GM_SINGLE);
+        rec_stop();
+
+        if (paused) {
             // game was exited via pause menu
-            conf_state()->in_progress = 1;
-            conf_state()->state_game = game_state;
-            conf_state()->state_obj = obj_state;
-            conf_write_crc();
+            conf_state_save(1);
         } else {
             // game ended with player death
-            conf_state()->in_progress = 0;
-            conf_write_crc();
+            conf_state_save(0);
 
             if ((!(conf_get()->debug_flags))
-                    && (game_state.score != 0)
-                    && score_ranking(game_state.score)) {
-                uint16_t name = ask_name(game_state.score);
+                    && (bcd_sign(&game_state.score) != 0)
+                    && score_ranking(&game_state.score)) {
+                uint16_t name = ask_name(&game_state.score);
                 struct scores s = { .name = name, .score = game_state.score };
                 score_add(s);
             }
@@ -25,7 +25,8 @@
 
 #define ENTRY_NAME_LEN 8
 #define CONF_ENTRY_COUNT 3
-#define DEBUG_ENTRY_COUNT 13
+#define DEBUG_ENTRY_COUNT 17
+#define DEBUG_MENU_TIER_INDEX (DEBUG_ENTRY_COUNT - 5)
 
 enum HW_TYPE {
     HW_DMG = 0,
@@ -49,11 +49,23 @@ const palette_color_t num_pal_inv[INV_PALETTE_COUNT * 4] = {
     RGB8(  0,  0,  0), RGB8(  0,  0,  0), RGB8(248,252,248), RGB8(  0,  0,  0)
 };
 
-// currently this assumption is hard-coded
-static_assert(bg_map_WIDTH == 256, "bg_map needs to be 256x256");
-static_assert(bg_map_HEIGHT == 256, "bg_map needs to be 256x256");
-static_assert(bg2_map_WIDTH == 256, "bg2_map needs to be 256x256");
-static_assert(bg2_map_HEIGHT == 256, "bg2_map needs to be 256x256");
+/*
+ * The game maps are streamed, see maps.c. map_line() reads a line
+ * of the map with a single bank switch, and the tiles come from
+ * the same bank. So all of a map has to fit into one ROM bank.
+ * Autobank would only fail at link time. The attributes are not
+ * stored, they come from palette_index and the mirroring.
+ */
+#define MAP_ROM_BANK_SIZE 0x4000
+
+static_assert((sizeof(bg_map_map) + sizeof(bg_map_tiles) + sizeof(bg_map_palettes)) <= MAP_ROM_BANK_SIZE,
+              "bg_map does not fit into one ROM bank");
+static_assert((sizeof(bg2_map_map) + sizeof(bg2_map_tiles) + sizeof(bg2_map_palettes)) <= MAP_ROM_BANK_SIZE,
+              "bg2_map does not fit into one ROM bank");
+static_assert((bg_map_WIDTH / bg_map_TILE_W) <= 0xFF, "bg_map too wide");
+static_assert((bg2_map_WIDTH / bg2_map_TILE_W) <= 0xFF, "bg2_map too wide");
+static_assert((bg_map_HEIGHT / bg_map_TILE_H) <= 0xFF, "bg_map too high");
+static_assert((bg2_map_HEIGHT / bg2_map_TILE_H) <= 0xFF, "bg2_map too high");
 
 struct maps maps[MAP_COUNT] = {
     { // MAP_TITLE
@@ -85,6 +97,7 @@ struct maps maps[MAP_COUNT] = {
         .tile_copy = BG_COPY_NONE,
         .bank = BANK(bg_map),
         .load = BG_LOAD_GAME,
+        .mirror = 1,
     },
     { // MAP_GAME_2
         .width = bg2_map_WIDTH / bg2_map_TILE_W,
@@ -100,6 +113,7 @@ struct maps maps[MAP_COUNT] = {
         .tile_copy = BG_COPY_NONE,
         .bank = BANK(bg2_map),
         .load = BG_LOAD_GAME,
+        .mirror = 1,
     },
     { // FNT_TEXT_16
         .width = text_fnt16_WIDTH / text_fnt16_TILE_W,
@@ -49,6 +49,7 @@ struct maps {
     uint8_t tile_copy;
     uint8_t bank;
     uint8_t load;
+    uint8_t mirror; // streamed with every other repetition flipped
 };
 
 extern struct maps maps[MAP_COUNT];
@@ -20,88 +20,201 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "banks.h"
 #include "config.h"
 #include "util.h"
+#include "lz.h"
 #include "map_data.h"
 #include "maps.h"
+#include "vram.h"
 
 #define POS_SCALE_BG 6
 
+/*
+ * The game maps are streamed into the 32x32 hardware tilemap,
+ * so they can be larger than it. The world repeats the map.
+ * On the GBC every other repetition can be mirrored, using the
+ * tile flip attributes, so the edges always match up.
+ *
+ * The drawn area reaches MAP_AHEAD tiles beyond the screen in
+ * each direction. Each crossed tile boundary queues one column
+ * or row for the VBlank handler. When the queue is full it is
+ * tried again next time, the margin hides that lag.
+ */
+
+#define MAP_HW_SIZE 32
+#define MAP_AHEAD 2
+#define MAP_VIS_W (DEVICE_SCREEN_WIDTH + 1)
+#define MAP_VIS_H (DEVICE_SCREEN_HEIGHT + 1)
+#define MAP_COL_LEN (MAP_VIS_H + (2 * MAP_AHEAD))
+#define MAP_ROW_LEN (MAP_VIS_W + (2 * MAP_AHEAD))
+
+// camera position in tiles, wraps with the scaled position
+#define MAP_POS_MASK ((0x10000UL >> POS_SCALE_BG >> 3) - 1)
+
+#define MAP_FLIP_X 0x20
+#define MAP_FLIP_Y 0x40
+
+static_assert(MAP_ROW_LEN <= MAP_HW_SIZE, "drawn area wider than the tilemap");
+static_assert(MAP_COL_LEN <= MAP_HW_SIZE, "drawn area higher than the tilemap");
+static_assert(((MAP_POS_MASK + 1) % MAP_HW_SIZE) == 0, "camera wraps inside the tilemap");
+
+struct map_axis {
+    uint8_t pos; // camera tile the drawn area belongs to
+    uint16_t src; // map tile at pos, counted in the period
+    uint16_t period; // map size, twice that when mirrored
+    uint8_t size; // map size
+};
+
 // current unscaled ship position
 static uint16_t abs_x, abs_y;
 
-// define this to disable mirrored map scaling support
-#define WRAP_BG // TODO
+static enum MAPS cur_map;
+static uint8_t cur_mirror;
+static struct map_axis axis_x, axis_y;
 
-#ifndef WRAP_BG
-#define bg_map_mapWidth (bg_map_WIDTH / bg_map_TILE_W)
-#define bg_map_mapHeight (bg_map_HEIGHT / bg_map_TILE_H)
+BANKREF(maps)
 
-#define camera_max_x ((bg_map_mapWidth - DEVICE_SCREEN_WIDTH) * 8)
-#define camera_max_y ((bg_map_mapHeight - DEVICE_SCREEN_HEIGHT) * 8)
+/*
+ * Loading the tiles for a screen is split over several frames,
+ * so the display can stay on. It overwrites the tiles still on
+ * screen, so the first MAP_FADE_STEPS steps only fade the
+ * background palettes to white. They stay blank until the new
+ * screen is drawn and map_load_show() restores them.
+ */
 
-#define MAP_FLIP_NONE 0x00
-#define MAP_FLIP_X (0x20 | 0x01)
-#define MAP_FLIP_Y (0x40 | 0x02)
-#define MAP_FLIP_XY (MAP_FLIP_X | MAP_FLIP_Y)
+#define MAP_LOAD_TILES 16 // uploaded per map_load_step()
+#define MAP_FADE_STEPS 4
+#define MAP_SHOWN_NONE 0xFF
 
-// current and old positions of the camera in pixels
-static uint16_t old_camera_x, old_camera_y;
+static const palette_color_t blank_palette[4] = {
+    RGB_WHITE, RGB_WHITE, RGB_WHITE, RGB_WHITE,
+};
 
-// current and old position of the map in tiles
-static uint8_t old_map_pos_x, old_map_pos_y;
-#endif // ! WRAP_BG
+static struct map_job job;
+static uint8_t shown_splash = MAP_SHOWN_NONE; // palettes on screen
+static uint8_t fade_bgp;
 
-BANKREF(maps)
+static uint8_t map_is_loaded(uint8_t i, uint8_t is_splash) {
+    if (!(maps[i].load & BG_LOAD_ALL)) {
+        if (is_splash) {
+            if (!(maps[i].load & BG_LOAD_SPLASH)) {
+                return 0;
+            }
+        } else {
+            if (maps[i].load & BG_LOAD_SPLASH) {
+                return 0;
+            }
+        }
+    }
 
-static void map_load_helper(uint8_t i) NONBANKED {
-    START_ROM_BANK(maps[i].bank) {
-        if (maps[i].tile_copy == BG_COPY_NONE) {
-            set_bkg_data(maps[i].tile_offset, maps[i].tile_count, maps[i].tiles);
+    if (_cpu != CGB_TYPE) {
+        if (maps[i].load & BG_LOAD_GBC_ONLY) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// next map after i with tiles of its own to upload
+static uint8_t map_load_next(struct map_job *j, uint8_t i) {
+    for (; i < MAP_COUNT; i++) {
+        if (map_is_loaded(i, j->is_splash) && (maps[i].tile_copy == BG_COPY_NONE)) {
+            j->left = maps[i].tile_count;
+            lz_begin(maps[i].tiles, maps[i].bank);
+            break;
+        }
+    }
+    return i;
+}
+
+static void map_load_palette(uint8_t i) NONBANKED {
+    uint8_t bank = maps[i].bank;
+    if (maps[i].palettes == num_pal_inv) {
+        bank = BANK(map_data);
+    }
+
+    START_ROM_BANK(bank) {
+        if (maps[i].palettes != NULL) {
+            set_bkg_palette(maps[i].palette_index, maps[i].palette_count, maps[i].palettes);
         }
     } END_ROM_BANK
+}
 
-    if (_cpu == CGB_TYPE) {
-        uint8_t bank = maps[i].bank;
-        if (maps[i].palettes == num_pal_inv) {
-            bank = BANK(map_data);
+// a color left / MAP_FADE_STEPS of the way from white
+static palette_color_t map_fade_color(palette_color_t c, uint8_t left) {
+    uint8_t r = 0x1F - ((((0x1F - ((c >> 0) & 0x1F))) * left) / MAP_FADE_STEPS);
+    uint8_t g = 0x1F - ((((0x1F - ((c >> 5) & 0x1F))) * left) / MAP_FADE_STEPS);
+    uint8_t b = 0x1F - ((((0x1F - ((c >> 10) & 0x1F))) * left) / MAP_FADE_STEPS);
+    return RGB(r, g, b);
+}
+
+static void map_fade_palette(uint8_t i, uint8_t left) NONBANKED {
+    uint8_t bank = maps[i].bank;
+    if (maps[i].palettes == num_pal_inv) {
+        bank = BANK(map_data);
+    }
+
+    if (maps[i].palettes == NULL) {
+        return;
+    }
+
+    for (uint8_t p = 0; p < maps[i].palette_count; p++) {
+        palette_color_t pal[4];
+        START_ROM_BANK(bank) {
+            memcpy(pal, maps[i].palettes + (p * 4), sizeof(pal));
+        } END_ROM_BANK
+
+        // back in this bank for map_fade_color()
+        for (uint8_t c = 0; c < 4; c++) {
+            pal[c] = map_fade_color(pal[c], left);
         }
+        set_bkg_palette(maps[i].palette_index + p, 1, pal);
+    }
+}
 
-        START_ROM_BANK_2(bank) {
-            if (maps[i].palettes != NULL) {
-                set_bkg_palette(maps[i].palette_index, maps[i].palette_count, maps[i].palettes);
+static void map_fade(uint8_t left) {
+    if (_cpu == CGB_TYPE) {
+        if ((left == 0) || (shown_splash == MAP_SHOWN_NONE)) {
+            for (uint8_t i = 0; i < 8; i++) {
+                set_bkg_palette(i, 1, blank_palette);
             }
-        } END_ROM_BANK
+        } else {
+            for (uint8_t i = 0; i < MAP_COUNT; i++) {
+                if (map_is_loaded(i, shown_splash)) {
+                    map_fade_palette(i, left);
+                }
+            }
+        }
+    } else {
+        // shades count down to white
+        uint8_t bgp = 0;
+        for (uint8_t s = 0; s < 8; s += 2) {
+            bgp |= ((((fade_bgp >> s) & 0x03) * left) / MAP_FADE_STEPS) << s;
+        }
+        BGP_REG = bgp;
     }
 }
 
-void map_load(uint8_t is_splash) BANKED {
+struct map_job *map_load_begin(uint8_t is_splash) BANKED {
+    // palettes are only faded from the next step on
+    job.fade = MAP_FADE_STEPS;
+    fade_bgp = BGP_REG;
+
     uint8_t off = BG_TILE_NUM_START;
     uint8_t off_gbc = BG_TILE_NUM_START;
 
     for (uint8_t i = 0; i < MAP_COUNT; i++) {
-        if (!(maps[i].load & BG_LOAD_ALL)) {
-            if (is_splash) {
-                if (!(maps[i].load & BG_LOAD_SPLASH)) {
-                    continue;
-                }
-            } else {
-                if (maps[i].load & BG_LOAD_SPLASH) {
-                    continue;
-                }
-            }
-        }
-
-        if (_cpu != CGB_TYPE) {
-            if (maps[i].load & BG_LOAD_GBC_ONLY) {
-                continue;
-            }
+        if (!map_is_loaded(i, is_splash)) {
+            continue;
         }
 
         if (maps[i].tile_copy == BG_COPY_NONE) {
             if (maps[i].load & BG_LOAD_GBC_ONLY) {
-                VBK_REG = VBK_BANK_1;
                 maps[i].tile_offset = off_gbc;
                 off_gbc += maps[i].tile_count;
             } else {
@@ -111,16 +224,64 @@ void map_load(uint8_t is_splash) BANKED {
         } else {
             maps[i].tile_offset = maps[maps[i].tile_copy].tile_offset;
         }
+    }
+
+    job.is_splash = is_splash;
+    job.map = map_load_next(&job, 0);
+    return &job;
+}
+
+uint8_t map_load_step(struct map_job *j) BANKED {
+    uint8_t budget = MAP_LOAD_TILES;
 
-        map_load_helper(i);
+    if (j->fade > 0) {
+        j->fade--;
+        map_fade(j->fade);
+        return 1;
     }
 
-    if (is_splash || (conf_get()->dmg_bg_inv == 0)) {
+    while ((j->map < MAP_COUNT) && (budget > 0)) {
+        uint8_t n = MIN(j->left, budget);
+
+        VBK_REG = (maps[j->map].load & BG_LOAD_GBC_ONLY) ? VBK_BANK_1 : VBK_BANK_0;
+        lz_bkg_data(maps[j->map].tile_offset + (maps[j->map].tile_count - j->left), n);
+        VBK_REG = VBK_BANK_0;
+
+        j->left -= n;
+        budget -= n;
+
+        if (j->left == 0) {
+            j->map = map_load_next(j, j->map + 1);
+        }
+    }
+
+    return j->map < MAP_COUNT;
+}
+
+void map_load_show(struct map_job *j) BANKED {
+    if (_cpu == CGB_TYPE) {
+        for (uint8_t i = 0; i < MAP_COUNT; i++) {
+            if (map_is_loaded(i, j->is_splash)) {
+                map_load_palette(i);
+            }
+        }
+    }
+
+    if (j->is_splash || (conf_get()->dmg_bg_inv == 0)) {
         BGP_REG = 0b11100100;
     } else {
         // invert BGP for DMG in-game
         BGP_REG = 0b00011011;
     }
+    shown_splash = j->is_splash;
+
+    lz_report();
+}
+
+void map_load(uint8_t is_splash) BANKED {
+    struct map_job *j = map_load_begin(is_splash);
+    while (map_load_step(j));
+    map_load_show(j);
 }
 
 void map_fill(enum MAPS map, uint8_t bkg) NONBANKED {
@@ -140,85 +301,177 @@ void map_fill(enum MAPS map, uint8_t bkg) NONBANKED {
         : move_win(MINWNDPOSX, MINWNDPOSY);
 }
 
-#ifndef WRAP_BG
-static inline void set_bkg_sub_attr(uint8_t x, uint8_t y,
-                                    uint8_t w, uint8_t h,
-                                    const uint8_t *attr,
-                                    uint8_t attr_val,
-                                    uint8_t map_w) {
-    if (attr) {
-        set_bkg_submap_attributes(x, y, w, h, attr, map_w);
-    } else {
-        VBK_REG = VBK_ATTRIBUTES;
-        fill_bkg_rect(x, y, w, h, attr_val);
-        VBK_REG = VBK_TILES;
+// map tile and flip for the tile off tiles away from pos
+static uint16_t map_src(struct map_axis *a, int8_t off, uint8_t *flip, uint8_t flip_bit) NONBANKED {
+    uint16_t s = a->src + (a->period * (MAP_AHEAD + 1)) + off;
+    while (s >= a->period) {
+        s -= a->period;
+    }
+
+    if (s >= a->size) {
+        *flip |= flip_bit;
+        return a->period - 1 - s;
     }
+    return s;
 }
 
-static inline void set_bkg_sub(uint8_t x, uint8_t y,
-                               uint8_t w, uint8_t h,
-                               const uint8_t *map, const uint8_t *attr,
-                               uint8_t attr_val,
-                               uint8_t map_w) {
-    START_ROM_BANK(BANK(bg_map)) {
-        set_bkg_submap(x, y, w, h, map, map_w);
-        set_bkg_sub_attr(x, y, w, h, attr, attr_val, map_w);
-    } END_ROM_BANK
+// commands needed for a line, split at the end of the tilemap
+static uint8_t map_chunks(uint8_t start, uint8_t len) NONBANKED {
+    uint8_t n = 0;
+    while (len > 0) {
+        uint8_t c = MIN(MIN(VRAM_DATA_LEN, MAP_HW_SIZE - start), len);
+        start = (start + c) & (MAP_HW_SIZE - 1);
+        len -= c;
+        n++;
+    }
+    return n;
 }
-#endif // ! WRAP_BG
-
-// TODO
-#ifndef WRAP_BG
-void map_game(void) NONBANKED {
-    START_ROM_BANK(BANK(bg_map)) {
-        abs_x = 0;
-        abs_y = 0;
-        old_camera_x = 0;
-        old_camera_y = 0;
-        old_map_pos_x = 0;
-        old_map_pos_y = 0;
-
-        move_bkg(0, 0);
-
-        // Draw the initial map view for the whole screen
-        set_bkg_sub(0, 0,
-                    MIN(DEVICE_SCREEN_WIDTH + 1u, bg_map_mapWidth),
-                    MIN(DEVICE_SCREEN_HEIGHT + 1u, bg_map_mapHeight),
-                    bg_map_map, bg_map_MAP_ATTRIBUTES, MAP_FLIP_NONE, bg_map_mapWidth);
+
+/*
+ * Draws a column (vertical) or row of the drawn area, off tiles
+ * away from the camera tile. Queued for VBlank, unless direct.
+ * Returns zero when it did not fit into the queue.
+ */
+static uint8_t map_line(uint8_t vertical, int8_t off, uint8_t direct) NONBANKED {
+    struct map_axis *along = vertical ? &axis_y : &axis_x;
+    struct map_axis *across = vertical ? &axis_x : &axis_y;
+    uint8_t len = vertical ? MAP_COL_LEN : MAP_ROW_LEN;
+
+    uint8_t fixed = (across->pos + off) & (MAP_HW_SIZE - 1);
+    uint8_t start = (along->pos - MAP_AHEAD) & (MAP_HW_SIZE - 1);
+
+    if (!direct) {
+        uint8_t need = map_chunks(start, len);
+        if (_cpu == CGB_TYPE) {
+            need *= 2;
+        }
+        if (vram_space() < need) {
+            return 0;
+        }
+    }
+
+    uint8_t tiles[MAP_ROW_LEN];
+    uint8_t attrs[MAP_ROW_LEN];
+
+    uint8_t flip_fixed = 0;
+    uint16_t src_fixed = map_src(across, off, &flip_fixed, vertical ? MAP_FLIP_X : MAP_FLIP_Y);
+
+    START_ROM_BANK(maps[cur_map].bank) {
+        for (uint8_t i = 0; i < len; i++) {
+            uint8_t flip = flip_fixed;
+            uint16_t src = map_src(along, i - MAP_AHEAD, &flip, vertical ? MAP_FLIP_Y : MAP_FLIP_X);
+            uint16_t idx = vertical ? ((src * maps[cur_map].width) + src_fixed)
+                                    : ((src_fixed * maps[cur_map].width) + src);
+            tiles[i] = maps[cur_map].map[idx] + maps[cur_map].tile_offset;
+            attrs[i] = maps[cur_map].palette_index | flip;
+        }
     } END_ROM_BANK
+
+    for (uint8_t i = 0; i < len; ) {
+        uint8_t c = MIN(MIN(VRAM_DATA_LEN, MAP_HW_SIZE - start), len - i);
+        uint8_t x = vertical ? fixed : start;
+        uint8_t y = vertical ? start : fixed;
+        uint8_t w = vertical ? 1 : c;
+        uint8_t h = vertical ? c : 1;
+
+        if (direct) {
+            if (_cpu == CGB_TYPE) {
+                VBK_REG = VBK_ATTRIBUTES;
+                set_bkg_tiles(x, y, w, h, attrs + i);
+            }
+            VBK_REG = VBK_TILES;
+            set_bkg_tiles(x, y, w, h, tiles + i);
+        } else {
+            if (_cpu == CGB_TYPE) {
+                vram_bkg_attrs(x, y, w, h, attrs + i);
+            }
+            vram_bkg_tiles(x, y, w, h, tiles + i);
+        }
+
+        start = (start + c) & (MAP_HW_SIZE - 1);
+        i += c;
+    }
+
+    return 1;
 }
-#endif // ! WRAP_BG
-
-#ifndef WRAP_BG
-static inline void set(uint8_t dst_x, uint8_t dst_y,
-                       uint8_t src_x, uint8_t src_y,
-                       uint8_t attr) {
-    START_ROM_BANK(BANK(bg_map)) {
-        set_bkg_tile_xy(dst_x, dst_y, bg_map_map[src_x + (src_y * (bg_map_WIDTH / bg_map_TILE_W))]);
-        set_bkg_attribute_xy(dst_x, dst_y, attr);
-    } END_ROM_BANK
+
+static void map_redraw(void) NONBANKED {
+    for (int8_t off = -MAP_AHEAD; off < (MAP_VIS_W + MAP_AHEAD); off++) {
+        map_line(1, off, 1);
+    }
+}
+
+static void map_axis_init(struct map_axis *a, uint8_t size) {
+    a->pos = 0;
+    a->src = 0;
+    a->size = size;
+    a->period = cur_mirror ? (2 * size) : size;
+}
+
+void map_game(enum MAPS map) BANKED {
+    cur_map = map;
+    cur_mirror = maps[map].mirror && (_cpu == CGB_TYPE);
+
+    abs_x = 0;
+    abs_y = 0;
+    map_axis_init(&axis_x, maps[map].width);
+    map_axis_init(&axis_y, maps[map].height);
+
+    map_redraw();
+    move_bkg(0, 0);
 }
-#endif // ! WRAP_BG
 
 void map_dbg_reset(void) NONBANKED {
-#ifndef WRAP_BG
-    uint16_t camera_x = abs_x >> POS_SCALE_BG;
-    uint16_t camera_y = abs_y >> POS_SCALE_BG;
-    uint8_t map_pos_x = camera_x >> 3;
-    uint8_t map_pos_y = camera_y >> 3;
-    for (uint8_t x = 0; x < DEVICE_SCREEN_WIDTH; x++) {
-        for (uint8_t y = 0; y < DEVICE_SCREEN_HEIGHT; y++) {
-            uint8_t is_flipped_x = ((camera_x >> 3) + x) & 0x10;
-            uint8_t is_flipped_y = ((camera_y >> 3) + y) & 0x10;
-            uint8_t attr = is_flipped_y ? (is_flipped_x ? MAP_FLIP_XY : MAP_FLIP_Y)
-                                        : (is_flipped_x ? MAP_FLIP_X : MAP_FLIP_NONE);
-            set(x, y,
-                is_flipped_x ? bg_map_mapWidth - map_pos_x : map_pos_x,
-                is_flipped_y ? bg_map_mapHeight - map_pos_y : map_pos_y,
-                attr);
+    // the queued lines are part of what gets drawn again
+    vram_flush();
+    map_redraw();
+}
+
+static void map_advance(struct map_axis *a, int8_t dir) NONBANKED {
+    if (dir > 0) {
+        a->pos = (a->pos + 1) & MAP_POS_MASK;
+        a->src = (a->src == (a->period - 1)) ? 0 : (a->src + 1);
+    } else {
+        a->pos = (a->pos - 1) & MAP_POS_MASK;
+        a->src = (a->src == 0) ? (a->period - 1) : (a->src - 1);
+    }
+}
+
+/*
+ * Moves the drawn area one tile towards the camera, if needed.
+ * Returns non-zero when it fell too far behind for that, then
+ * the area is moved to the camera and has to be drawn again.
+ */
+static uint8_t map_step(uint8_t vertical, uint8_t pos) NONBANKED {
+    struct map_axis *a = vertical ? &axis_y : &axis_x;
+
+    int8_t diff = (pos - a->pos) & MAP_POS_MASK;
+    if (diff >= ((MAP_POS_MASK + 1) / 2)) {
+        diff -= MAP_POS_MASK + 1;
+    }
+
+    if ((diff > MAP_AHEAD) || (diff < -MAP_AHEAD)) {
+        for (; diff > 0; diff--) {
+            map_advance(a, 1);
         }
+        for (; diff < 0; diff++) {
+            map_advance(a, -1);
+        }
+        return 1;
     }
-#endif // ! WRAP_BG
+
+    // the new line is one past the old drawn area
+    if (diff > 0) {
+        if (map_line(!vertical, (vertical ? MAP_VIS_H : MAP_VIS_W) + MAP_AHEAD, 0)) {
+            map_advance(a, 1);
+        }
+    } else if (diff < 0) {
+        if (map_line(!vertical, -MAP_AHEAD - 1, 0)) {
+            map_advance(a, -1);
+        }
+    }
+
+    return 0;
 }
 
 void map_move(int16_t delta_x, int16_t delta_y) NONBANKED {
@@ -230,62 +483,11 @@ void map_move(int16_t delta_x, int16_t delta_y) NONBANKED {
 
     move_bkg(camera_x, camera_y);
 
-#ifndef WRAP_BG
-
-    uint8_t map_pos_x = camera_x >> 3;
-    uint8_t map_pos_y = camera_y >> 3;
-
-    uint8_t is_flipped_x_left = (camera_x >> 3) & 0x10;
-    uint8_t is_flipped_x_right = ((camera_x >> 3) + DEVICE_SCREEN_WIDTH) & 0x10;
-    uint8_t is_flipped_y_top = (camera_y >> 3) & 0x10;
-    uint8_t is_flipped_y_bottom = ((camera_y >> 3) + DEVICE_SCREEN_HEIGHT) & 0x10;
-
-    if (map_pos_x != old_map_pos_x) {
-        old_map_pos_x = map_pos_x;
-
-        if (camera_x < old_camera_x) {
-            // moving left
-            set_bkg_sub(map_pos_x, map_pos_y,
-                        1, MIN(DEVICE_SCREEN_HEIGHT + 1, bg_map_mapHeight - map_pos_y),
-                        bg_map_map, bg_map_MAP_ATTRIBUTES, MAP_FLIP_X, bg_map_mapWidth);
-        } else if ((bg_map_mapWidth - DEVICE_SCREEN_WIDTH) > map_pos_x) {
-            // moving right
-            /*
-            set_bkg_sub(map_pos_x + DEVICE_SCREEN_WIDTH, map_pos_y,
-                        1, MIN(DEVICE_SCREEN_HEIGHT + 1, bg_map_mapHeight - map_pos_y),
-                        bg_map_map, bg_map_MAP_ATTRIBUTES, MAP_FLIP_NONE, bg_map_mapWidth);
-            */
-            for (uint8_t i = 0; i < DEVICE_SCREEN_HEIGHT; i++) {
-                uint8_t is_flipped_y = (map_pos_y + i) & 0x04;
-                uint8_t attr = is_flipped_y ? (is_flipped_x_right ? MAP_FLIP_XY : MAP_FLIP_Y)
-                                            : (is_flipped_x_right ? MAP_FLIP_X : MAP_FLIP_NONE);
-                set(map_pos_x + DEVICE_SCREEN_WIDTH, map_pos_y + i,
-                    is_flipped_x_right ? bg_map_mapWidth - map_pos_x : map_pos_x,
-                    is_flipped_y ? bg_map_mapHeight - map_pos_y : map_pos_y,
-                    attr);
-            }
-        }
-    }
+    uint8_t lost = map_step(0, camera_x >> 3);
+    lost |= map_step(1, camera_y >> 3);
 
-    if (map_pos_y != old_map_pos_y) {
-        old_map_pos_y = map_pos_y;
-
-        if (camera_y < old_camera_y) {
-            // moving up
-            set_bkg_sub(map_pos_x, map_pos_y,
-                        MIN(DEVICE_SCREEN_WIDTH + 1, bg_map_mapWidth - map_pos_x), 1,
-                        bg_map_map, bg_map_MAP_ATTRIBUTES, MAP_FLIP_Y, bg_map_mapWidth);
-        } else if ((bg_map_mapHeight - DEVICE_SCREEN_HEIGHT) > map_pos_y) {
-            // moving down
-            set_bkg_sub(map_pos_x, map_pos_y + DEVICE_SCREEN_HEIGHT,
-                        MIN(DEVICE_SCREEN_WIDTH + 1, bg_map_mapWidth - map_pos_x), 1,
-                        bg_map_map, bg_map_MAP_ATTRIBUTES, MAP_FLIP_NONE, bg_map_mapWidth);
-        }
+    // only when scrolling faster than the queue, in debug mode
+    if (lost) {
+        map_dbg_reset();
     }
-
-    // set old camera position to current camera position
-    old_camera_x = camera_x;
-    old_camera_y = camera_y;
-
-#endif // ! WRAP_BG
 }
@@ -39,8 +39,19 @@ enum MAPS {
     MAP_COUNT
 };
 
+struct map_job {
+    uint8_t is_splash;
+    uint8_t fade; // palette steps left before the first tiles
+    uint8_t map; // uploading its tiles, MAP_COUNT when done
+    uint8_t left; // tiles of it still to upload
+};
+
+struct map_job *map_load_begin(uint8_t is_splash) BANKED;
+uint8_t map_load_step(struct map_job *j) BANKED;
+void map_load_show(struct map_job *j) BANKED;
 void map_load(uint8_t is_splash) BANKED;
 void map_fill(enum MAPS map, uint8_t bkg);
+void map_game(enum MAPS map) BANKED;
 void map_move(int16_t delta_x, int16_t delta_y);
 
 void map_dbg_reset(void);
@@ -18,6 +18,10 @@
  */
 
 #include <gbdk/emu_debug.h>
+#include <assert.h>
+#include <stddef.h>
+#undef NULL
+#include <string.h>
 
 #include "game.h"
 #include "timer.h"
@@ -27,22 +31,6 @@
 #define SLAVE_HELLO 0x23
 
 #define RETRANSMIT_TIME_HELLO 200
-#define RETRANSMIT_TIME_GAME 10
-
-#define PKT_TYPE_PLAYER 0x00
-#define PKT_TYPE_SHOT 0x01
-
-struct mp_header {
-    uint8_t type;
-};
-
-struct mp_packet {
-    struct mp_header header;
-    union {
-        struct mp_player_state player;
-        struct mp_shot_state shot;
-    };
-};
 
 enum mp_state {
     MP_M_SEND = 0,
@@ -56,11 +44,12 @@ enum mp_state {
 
 static enum mp_state state = 0;
 static uint16_t next_t = 0;
-static uint8_t our_turn = 0;
 
 uint8_t mp_connection_status = 0;
+uint8_t mp_is_master = 0;
 
 static void mp_game_init(void);
+static void mp_game_done(void);
 
 static inline void Tx(uint8_t x) {
     SB_REG = x;
@@ -125,9 +114,11 @@ uint8_t mp_master_ready(void) BANKED {
 }
 
 void mp_master_start(void) BANKED {
-    our_turn = 1;
+    mp_is_master = 1;
+    game_init();
     mp_game_init();
     game(GM_MULTI);
+    mp_game_done();
     state = 0;
 }
 
@@ -176,9 +167,11 @@ uint8_t mp_slave_ready(void) BANKED {
 }
 
 void mp_slave_start(void) BANKED {
-    our_turn = 0;
+    mp_is_master = 0;
+    game_init();
     mp_game_init();
     game(GM_MULTI);
+    mp_game_done();
     state = 0;
 }
 
@@ -186,130 +179,291 @@ void mp_slave_start(void) BANKED {
 // Game Runtime
 // ----------------------------------------------------------------------------
 
-#define QUEUE_LEN 5
+/*
+ * Both sides stream fixed size frames through the serial
+ * interrupt. Every exchange moves one byte in each direction.
+ * The master clocks one byte per timer tick, so the slave has
+ * a whole tick to load its next byte, even when its VBlank or
+ * timer handler runs first. Frames without a shot leave out
+ * the shot fields, with the default 256Hz that gives about 23
+ * frames per second in each direction, 17 while shots are sent.
+ *
+ * Every frame carries the newest player state, so a lost one
+ * is simply replaced by the next. Shots are numbered from 1
+ * to 255, zero means no shot. New shots are sent once, one
+ * per frame. The ones still unacknowledged after
+ * MP_SHOT_RESEND are sent again. The other side only accepts
+ * them in order, so the number of the last one received
+ * acknowledges all before it as well.
+ *
+ * frame: MP_SYNC, acknowledged shot, shot number, player, [shot,] CRC-8
+ * Between frames the line carries MP_IDLE.
+ */
+#define MP_SYNC 0xA5
+#define MP_IDLE 0x00
+
+#define MP_TX_LEN 8 // frames, one slot stays empty, to tell full from empty
+#define MP_TX_AHEAD 2 // frames queued including the one on the wire
+#define MP_RX_LEN 8
+#define MP_SHOT_LEN 16 // unacknowledged shots, one slot stays empty
+
+#define MP_SHOT_RESEND (TIMER_HZ / 4) // longer than a round trip
+#define MP_LINK_TIMEOUT (2 * TIMER_HZ)
+
+struct mp_frame {
+    uint8_t sync;
+    uint8_t ack; // last shot number received
+    uint8_t seq; // number of the shot below
+    struct mp_player_state player;
+    struct mp_shot_state shot;
+    uint8_t crc; // needs to be last
+};
+
+#define MP_CRC_START offsetof(struct mp_frame, ack)
+#define MP_SHOT_POS offsetof(struct mp_frame, shot)
+#define MP_CRC_POS offsetof(struct mp_frame, crc)
 
-static struct mp_packet queue[QUEUE_LEN];
-static uint8_t q_head = 0;
-static uint8_t q_tail = 0;
-static uint8_t q_full = 0;
-static uint8_t byte_pos = 0;
+static_assert(MP_CRC_POS == (sizeof(struct mp_frame) - 1), "crc needs to be last");
+static_assert(MP_CRC_POS == (MP_SHOT_POS + sizeof(struct mp_shot_state)), "shot is skipped up to the crc");
 
-static uint8_t q_len(void) {
-    if (q_head == q_tail) {
-        if (q_full) {
-            return QUEUE_LEN;
-        } else {
-            return 0;
-        }
-    } else if (q_head > q_tail) {
-        return q_head - q_tail;
-    } else {
-        return QUEUE_LEN - q_tail + q_head;
+// CRC-8, polynomial 0x07, one nibble at a time
+static const uint8_t crc_nibble[16] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15,
+    0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+};
+
+// heads are only moved by the consumer, tails only by the producer
+static struct mp_frame tx_queue[MP_TX_LEN];
+static volatile uint8_t tx_head = 0;
+static volatile uint8_t tx_tail = 0;
+static uint8_t tx_pos = 0;
+
+static struct mp_frame rx_queue[MP_RX_LEN];
+static volatile uint8_t rx_head = 0;
+static volatile uint8_t rx_tail = 0;
+static uint8_t rx_pos = 0;
+
+// shots waiting for their acknowledgement, only used by the main loop
+static struct mp_shot_state shots[MP_SHOT_LEN];
+static uint8_t shot_head = 0;
+static uint8_t shot_tail = 0;
+static uint8_t shot_next = 0; // next one to send
+static uint16_t shot_sent_t = 0; // when the one at shot_head was sent last
+static uint8_t shot_seq = 0; // number of the shot at shot_head, never zero
+static uint8_t rx_shot_seq = 0;
+
+static uint16_t last_rx = 0;
+
+static uint8_t mp_crc(const uint8_t *d, uint8_t len) {
+    uint8_t c = 0;
+    while (len--) {
+        c ^= *d++;
+        c = (c << 4) ^ crc_nibble[c >> 4];
+        c = (c << 4) ^ crc_nibble[c >> 4];
+    }
+    return c;
+}
+
+// only over the bytes on the wire
+static uint8_t mp_frame_crc(const struct mp_frame *f) {
+    return mp_crc((const uint8_t *)f + MP_CRC_START,
+                  (f->seq ? MP_CRC_POS : MP_SHOT_POS) - MP_CRC_START);
+}
+
+static inline uint8_t mp_next_seq(uint8_t seq) {
+    return (seq == 0xFF) ? 1 : (seq + 1);
+}
+
+// shots from a to b, skipping zero
+static inline uint8_t mp_seq_diff(uint8_t b, uint8_t a) {
+    return (b >= a) ? (b - a) : (b - a - 1);
+}
+
+static uint8_t mp_tx_byte(void) NONBANKED {
+    if (tx_head == tx_tail) {
+        return MP_IDLE;
+    }
+
+    const struct mp_frame *f = &tx_queue[tx_head];
+    uint8_t b = ((const uint8_t *)f)[tx_pos++];
+    if ((tx_pos == MP_SHOT_POS) && (f->seq == 0)) {
+        tx_pos = MP_CRC_POS;
+    } else if (tx_pos >= sizeof(struct mp_frame)) {
+        tx_pos = 0;
+        tx_head = (tx_head + 1) & (MP_TX_LEN - 1);
     }
+    return b;
 }
 
-static inline void q_inc_head(void) {
-    if (q_full && (++q_tail == QUEUE_LEN)) {
-        q_tail = 0;
+static void mp_sio_isr(void) NONBANKED {
+    uint8_t rx = SB_REG;
+
+    if (rx_pos != 0) {
+        struct mp_frame *f = &rx_queue[rx_tail];
+        ((uint8_t *)f)[rx_pos++] = rx;
+        if ((rx_pos == MP_SHOT_POS) && (f->seq == 0)) {
+            rx_pos = MP_CRC_POS;
+        } else if (rx_pos >= sizeof(struct mp_frame)) {
+            rx_pos = 0;
+
+            // when full, the slot is reused for the next frame
+            uint8_t next = (rx_tail + 1) & (MP_RX_LEN - 1);
+            if (next != rx_head) {
+                rx_tail = next;
+            }
+        }
+    } else if (rx == MP_SYNC) {
+        rx_queue[rx_tail].sync = rx;
+        rx_pos = 1;
     }
-    if (++q_head == QUEUE_LEN) {
-        q_head = 0;
+
+    // no Tx() / Rx() here, those live in a switchable bank
+    SB_REG = mp_tx_byte();
+    if (!mp_is_master) {
+        SC_REG = SIOF_XFER_START | SIOF_CLOCK_EXT;
     }
-    q_full = (q_head == q_tail);
 }
 
-static inline void q_inc_tail(void) {
-    q_tail++;
-    if (q_tail >= QUEUE_LEN) {
-        q_tail = 0;
+// master only, the next byte already waits in SB
+static void mp_tim_isr(void) NONBANKED {
+    if (!(SC_REG & SIOF_XFER_START)) {
+        SC_REG = SIOF_XFER_START | SIOF_CLOCK_INT;
     }
 }
 
 static void mp_game_init(void) {
-    q_head = 0;
-    q_tail = 0;
-    q_full = 0;
-    byte_pos = sizeof(struct mp_packet); // immediately query packet from game
-    next_t = timer_get() + RETRANSMIT_TIME_GAME;
+    tx_head = 0;
+    tx_tail = 0;
+    tx_pos = 0;
+    rx_head = 0;
+    rx_tail = 0;
+    rx_pos = 0;
+    shot_head = 0;
+    shot_tail = 0;
+    shot_next = 0;
+    shot_sent_t = 0;
+    shot_seq = 1;
+    rx_shot_seq = 0;
+    last_rx = timer_get();
+
+    CRITICAL {
+        add_SIO(mp_sio_isr);
+        IF_REG &= ~SIO_IFLAG; // left over from the handshake
+        set_interrupts(IE_REG | SIO_IFLAG);
+
+        if (mp_is_master) {
+            SB_REG = MP_IDLE;
+            add_TIM(mp_tim_isr);
+        } else {
+            Rx(MP_IDLE);
+        }
+    }
 }
 
-static inline void handle_rx(struct mp_packet *pkt) {
-    switch (pkt->header.type) {
-        case PKT_TYPE_PLAYER:
-            game_set_mp_player2(&pkt->player);
-            break;
+static void mp_game_done(void) {
+    CRITICAL {
+        set_interrupts(IE_REG & ~SIO_IFLAG);
+        remove_SIO(mp_sio_isr);
+        if (mp_is_master) {
+            remove_TIM(mp_tim_isr);
+        }
+        SC_REG = 0;
+    }
+}
 
-        case PKT_TYPE_SHOT:
-            game_set_mp_shot(&pkt->shot);
-            break;
+static void mp_send(const struct mp_player_state *state) {
+    // a frame waiting behind the current one is enough
+    if (((tx_tail - tx_head) & (MP_TX_LEN - 1)) >= MP_TX_AHEAD) {
+        return;
+    }
 
-        default:
-#ifdef DEBUG
-            EMU_printf("%s: unknown type %hx\n", __func__, (uint8_t)pkt->header.type);
-#endif // DEBUG
-            break;
+    struct mp_frame *f = &tx_queue[tx_tail];
+    f->sync = MP_SYNC;
+    f->ack = rx_shot_seq;
+    f->player = *state;
+    if ((shot_head != shot_tail) && ((uint16_t)(timer_get() - shot_sent_t) >= MP_SHOT_RESEND)) {
+        shot_next = shot_head;
     }
-}
 
-static inline void tx_rx(uint8_t x) {
-    our_turn ? Tx(x) : Rx(x);
-    next_t = timer_get() + RETRANSMIT_TIME_GAME;
-}
+    if (shot_next != shot_tail) {
+        if (shot_next == shot_head) {
+            shot_sent_t = timer_get();
+        }
 
-void mp_handle(void) BANKED {
-    // ensure we always have something in the queue
-    if ((q_len() == 0) && (byte_pos >= sizeof(struct mp_packet))) {
-        game_get_mp_state();
+        uint8_t n = (shot_next - shot_head) & (MP_SHOT_LEN - 1);
+        uint16_t seq = shot_seq + n;
+        f->seq = (seq > 0xFF) ? (seq - 0xFF) : seq;
+        f->shot = shots[shot_next];
+        shot_next = (shot_next + 1) & (MP_SHOT_LEN - 1);
+    } else {
+        f->seq = 0;
     }
+    f->crc = mp_frame_crc(f);
 
-    if (byte_pos < sizeof(struct mp_packet)) {
-        if ((our_turn && (timer_get() >= next_t)) || ((!our_turn) && (!transmitting()))) {
-            uint8_t to_send = ((uint8_t *)(&queue[q_tail]))[byte_pos];
-            ((uint8_t *)(&queue[q_tail]))[byte_pos] = SB_REG;
-            tx_rx(to_send);
-
-            byte_pos++;
-            if (byte_pos >= sizeof(struct mp_packet)) {
-                handle_rx(&queue[q_tail]);
-                q_inc_tail();
-                if (q_len() > 0) {
-                    byte_pos = 0; // keep going
-                }
-            }
+    // publish only when complete
+    tx_tail = (tx_tail + 1) & (MP_TX_LEN - 1);
+}
 
-            our_turn = our_turn ? 0 : 1;
+static inline void handle_ack(uint8_t ack) {
+    if (ack == 0) {
+        return;
+    }
+
+    // older acknowledgements are further away than the queue is long
+    uint8_t n = mp_seq_diff(ack, shot_seq);
+    while ((shot_head != shot_tail) && (n < (MP_SHOT_LEN - 1))) {
+        if (shot_next == shot_head) {
+            shot_next = (shot_next + 1) & (MP_SHOT_LEN - 1);
         }
+        shot_head = (shot_head + 1) & (MP_SHOT_LEN - 1);
+        shot_seq = mp_next_seq(shot_seq);
+        n--;
     }
 }
 
-void mp_new_state(struct mp_player_state *state) BANKED {
-#ifdef DEBUG
-    if (q_full) {
-        EMU_printf("%s: queue overflow\n", __func__);
+static inline void handle_rx(struct mp_frame *f) {
+    handle_ack(f->ack);
+    game_set_mp_player2(&f->player);
+
+    // repeats of the last one only need the acknowledgement again
+    if ((f->seq != 0) && (f->seq == mp_next_seq(rx_shot_seq))) {
+        rx_shot_seq = f->seq;
+        game_set_mp_shot(&f->shot);
     }
-#endif // DEBUG
+}
+
+uint8_t mp_handle(void) BANKED {
+    while (rx_head != rx_tail) {
+        struct mp_frame *f = &rx_queue[rx_head];
 
-    queue[q_head].header.type = PKT_TYPE_PLAYER;
-    queue[q_head].player = *state;
-    q_inc_head();
+        if (mp_frame_crc(f) == f->crc) {
+            last_rx = timer_get();
+            handle_rx(f);
+        } else {
+#ifdef DEBUG
+            EMU_printf("%s: bad checksum\n", __func__);
+#endif // DEBUG
+        }
 
-    if ((q_len() == 1) && (byte_pos >= sizeof(struct mp_packet))) {
-        byte_pos = 0; // start transmitting
+        rx_head = (rx_head + 1) & (MP_RX_LEN - 1);
     }
+
+    return (timer_get() - last_rx) < MP_LINK_TIMEOUT;
+}
+
+void mp_new_state(struct mp_player_state *state) BANKED {
+    mp_send(state);
 }
 
 void mp_add_shot(struct mp_shot_state *state) BANKED {
+    uint8_t next = (shot_tail + 1) & (MP_SHOT_LEN - 1);
+    if (next == shot_head) {
 #ifdef DEBUG
-    if (q_full) {
         EMU_printf("%s: queue overflow\n", __func__);
-    }
 #endif // DEBUG
-
-    queue[q_head].header.type = PKT_TYPE_SHOT;
-    queue[q_head].shot = *state;
-    q_inc_head();
-
-    if ((q_len() == 1) && (byte_pos >= sizeof(struct mp_packet))) {
-        byte_pos = 0; // start transmitting
+        return;
     }
+
+    shots[shot_tail] = *state;
+    shot_tail = next;
 }
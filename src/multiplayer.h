@@ -25,14 +25,17 @@
 
 #include "sprites.h"
 
+// positions are in pixels on the 256x256 playing field, which wraps around
 struct mp_player_state {
-    int8_t pos_x, pos_y;
+    uint8_t pos_x, pos_y;
     int8_t spd_x, spd_y;
-    enum SPRITE_ROT rot;
+    uint8_t rot; // enum SPRITE_ROT
+    uint8_t moving;
+    uint8_t health; // zero once the ship exploded
 };
 
 struct mp_shot_state {
-    int8_t pos_x, pos_y;
+    uint8_t pos_x, pos_y;
     int8_t spd_x, spd_y;
 };
 
@@ -42,11 +45,13 @@ void mp_master_start(void) BANKED;
 uint8_t mp_slave_ready(void) BANKED;
 void mp_slave_start(void) BANKED;
 
-void mp_handle(void) BANKED;
+// zero when nothing arrived for too long
+uint8_t mp_handle(void) BANKED;
 
 void mp_new_state(struct mp_player_state *state) BANKED;
 void mp_add_shot(struct mp_shot_state *state) BANKED;
 
 extern uint8_t mp_connection_status;
+extern uint8_t mp_is_master;
 
 #endif // __MULTIPLAYER_H__
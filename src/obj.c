@@ -17,21 +17,26 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
+#include <assert.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <rand.h>
 
 #include "sprites.h"
 #include "game.h"
 #include "sample.h"
 #include "obj.h"
+#include "table_gravity.h"
 
 #define POS_SCALE_OBJS 5
 #define POS_OBJS_MAX (INT16_MAX >> (8 - POS_SCALE_OBJS))
 #define POS_OBJS_MIN (-(INT16_MAX >> (8 - POS_SCALE_OBJS)) - 1)
 
-#define GRAVITY_RANGE (24 << POS_SCALE_OBJS)
-#define GRAVITY_SHIFT (POS_SCALE_OBJS + 4)
+// pull of the orbs, range and strength are set in the Makefile
+#define GRAVITY_RANGE table_gravity_RANGE
+#define GRAVITY(off) table_gravity[(uint16_t)((off) + GRAVITY_RANGE) >> table_gravity_QUANT]
+static_assert(table_gravity_SCALE == POS_SCALE_OBJS, "regenerate table_gravity");
 
 #define DAMAGE_RANGE (14 << POS_SCALE_OBJS)
 #define DAMAGE_INC 4
@@ -42,8 +47,9 @@
 #define PICKUP_SMALL_RANGE (12 << POS_SCALE_OBJS)
 #define SHOT_RANGE (10 << POS_SCALE_OBJS)
 
-#define SCORE_SMALL 5
-#define SCORE_LARGE 10
+// packed BCD
+#define SCORE_SMALL 0x05
+#define SCORE_LARGE 0x10
 
 //#define DESPAWN_RANGE (0x7F << POS_SCALE_OBJS)
 
@@ -55,36 +61,154 @@
 
 struct obj_state obj_state;
 
-static const uint8_t obj_max[SPRITE_COUNT] = {
-    1, // SPR_SHIP
-    MAX_LIGHT, // SPR_LIGHT
-    MAX_DARK, // SPR_DARK
-    MAX_SHOT, // SPR_SHOT
-    MAX_SHOT_LIGHT, // SPR_SHOT_LIGHT
-    MAX_SHOT_DARK, // SPR_SHOT_DARK
-    4, // SPR_HEALTH
-    4, // SPR_POWER
-    1, // SPR_EXPL
-    1, // SPR_PAUSE
-    1, // SPR_DEBUG
-    1, // SPR_DEBUG_LARGE
+static const uint8_t obj_max[OBJ_TIER_COUNT][SPRITE_COUNT] = {
+    { // OBJ_TIER_DMG
+        1, // SPR_SHIP
+        MAX_LIGHT, // SPR_LIGHT
+        MAX_DARK, // SPR_DARK
+        MAX_SHOT, // SPR_SHOT
+        MAX_SHOT_LIGHT, // SPR_SHOT_LIGHT
+        MAX_SHOT_DARK, // SPR_SHOT_DARK
+        4, // SPR_HEALTH
+        4, // SPR_POWER
+        1, // SPR_EXPL
+        1, // SPR_PAUSE
+        1, // SPR_DEBUG
+        1, // SPR_DEBUG_LARGE
+    }, { // OBJ_TIER_GBC
+        1, // SPR_SHIP
+        MAX_LIGHT_GBC, // SPR_LIGHT
+        MAX_DARK_GBC, // SPR_DARK
+        MAX_SHOT_GBC, // SPR_SHOT
+        MAX_SHOT_LIGHT_GBC, // SPR_SHOT_LIGHT
+        MAX_SHOT_DARK_GBC, // SPR_SHOT_DARK
+        4, // SPR_HEALTH
+        4, // SPR_POWER
+        1, // SPR_EXPL
+        1, // SPR_PAUSE
+        1, // SPR_DEBUG
+        1, // SPR_DEBUG_LARGE
+    },
 };
 
+static enum OBJ_TIER obj_tier = OBJ_TIER_DMG;
+
+static uint8_t grid_list(enum SPRITES sprite) {
+    if ((sprite == SPR_LIGHT) || (sprite == SPR_DARK)) {
+        return OBJ_GRID_ORBS;
+    }
+    return OBJ_GRID_OTHER;
+}
+
+// x in pixels, clamped to the playing field
+static uint8_t grid_col(int16_t x) {
+    if (x < INT8_MIN) {
+        x = INT8_MIN;
+    } else if (x > INT8_MAX) {
+        x = INT8_MAX;
+    }
+    return (uint8_t)(x - INT8_MIN) >> OBJ_GRID_SHIFT;
+}
+
+static void grid_link(uint8_t i) {
+    uint8_t list = grid_list(obj_state.sprite[i]);
+    uint8_t col = grid_col(obj_state.off_x[i] >> POS_SCALE_OBJS);
+
+    obj_state.grid_col[i] = col;
+    obj_state.grid_next[i] = obj_state.grid_head[list][col];
+    obj_state.grid_head[list][col] = i + 1;
+}
+
+static void grid_unlink(uint8_t i) {
+    uint8_t *p = &obj_state.grid_head[grid_list(obj_state.sprite[i])][obj_state.grid_col[i]];
+    while (*p != (i + 1)) {
+        p = &obj_state.grid_next[*p - 1];
+    }
+    *p = obj_state.grid_next[i];
+}
+
+static void grid_move(uint8_t i) {
+    if (grid_col(obj_state.off_x[i] >> POS_SCALE_OBJS) != obj_state.grid_col[i]) {
+        grid_unlink(i);
+        grid_link(i);
+    }
+}
+
+static uint8_t obj_alloc(void) {
+    if (obj_state.live_cnt < MAX_OBJ) {
+        return obj_state.live_cnt++;
+    }
+
+    // only full during obj_do, before the gaps are closed
+    uint8_t i = 0;
+    while (obj_state.grid_col[i] != OBJ_GRID_DEAD) {
+        i++;
+    }
+    obj_state.dead_cnt--;
+    return i;
+}
+
+// only called from obj_do, which closes the gap afterwards
+static void obj_remove(uint8_t i) {
+    grid_unlink(i);
+    obj_state.obj_cnt[obj_state.sprite[i]]--;
+    obj_state.grid_col[i] = OBJ_GRID_DEAD;
+    obj_state.dead_cnt++;
+}
+
+// moves the objects behind the removed ones down, keeping their order
+static void obj_compact(void) {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < obj_state.live_cnt; i++) {
+        if (obj_state.grid_col[i] == OBJ_GRID_DEAD) {
+            continue;
+        }
+
+        if (n != i) {
+            obj_state.sprite[n] = obj_state.sprite[i];
+            obj_state.off_x[n] = obj_state.off_x[i];
+            obj_state.off_y[n] = obj_state.off_y[i];
+            obj_state.spd_x[n] = obj_state.spd_x[i];
+            obj_state.spd_y[n] = obj_state.spd_y[i];
+            obj_state.travel[n] = obj_state.travel[i];
+            obj_state.frame[n] = obj_state.frame[i];
+            obj_state.frame_index[n] = obj_state.frame_index[i];
+            obj_state.frame_count[n] = obj_state.frame_count[i];
+            obj_state.frame_duration[n] = obj_state.frame_duration[i];
+        }
+        n++;
+    }
+
+    obj_state.live_cnt = n;
+    obj_state.dead_cnt = 0;
+
+    // indices changed, so link everything again in slot order
+    memset(obj_state.grid_head, 0, sizeof(obj_state.grid_head));
+    while (n-- > 0) {
+        grid_link(n);
+    }
+}
+
 static uint8_t is_too_close(int8_t x, int8_t y, int8_t center_dist) {
     if ((abs(x) < center_dist) && (abs(y) < center_dist)) {
         return 1;
     }
 
-    for (uint8_t i = 0; i < MAX_OBJ; i++) {
-        if (!obj_state.objs[i].active) {
-            continue;
-        }
+    uint8_t first = grid_col(x - PLACEMENT_DISTANCE + 1);
+    uint8_t last = grid_col(x + PLACEMENT_DISTANCE - 1);
+
+    for (uint8_t list = 0; list < OBJ_GRID_LISTS; list++) {
+        for (uint8_t col = first; col <= last; col++) {
+            for (uint8_t n = obj_state.grid_head[list][col]; n != 0; n = obj_state.grid_next[n - 1]) {
+                uint8_t i = n - 1;
 
-        int dst_x = abs((obj_state.objs[i].off_x >> POS_SCALE_OBJS) - x);
-        int dst_y = abs((obj_state.objs[i].off_y >> POS_SCALE_OBJS) - y);
+                int dst_x = abs((obj_state.off_x[i] >> POS_SCALE_OBJS) - x);
+                int dst_y = abs((obj_state.off_y[i] >> POS_SCALE_OBJS) - y);
 
-        if ((dst_x < PLACEMENT_DISTANCE) && (dst_y < PLACEMENT_DISTANCE)) {
-            return 1;
+                if ((dst_x < PLACEMENT_DISTANCE) && (dst_y < PLACEMENT_DISTANCE)) {
+                    return 1;
+                }
+            }
         }
     }
 
@@ -104,88 +228,165 @@ static void generate_coords(int8_t *x_c, int8_t *y_c, int8_t center_dist) {
     *y_c = y;
 }
 
-static void obj_respawn_type(enum SPRITES spr, int8_t center_dist) {
-    while (obj_state.obj_cnt[spr] < obj_max[spr]) {
+static void obj_fill(enum SPRITES spr, uint8_t max, int8_t center_dist) {
+    while (obj_state.obj_cnt[spr] < max) {
         int8_t x, y;
         generate_coords(&x, &y, center_dist);
         obj_add(spr, x, y, 0, 0);
     }
 }
 
-void obj_spawn(void) BANKED {
-    obj_respawn_type(SPR_LIGHT, INITIAL_DISTANCE);
-    obj_respawn_type(SPR_DARK, INITIAL_DISTANCE);
-    obj_respawn_type(SPR_SHOT_LIGHT, INITIAL_DISTANCE);
-    obj_respawn_type(SPR_SHOT_DARK, INITIAL_DISTANCE);
+static void obj_respawn_type(enum SPRITES spr, int8_t center_dist) {
+    obj_fill(spr, obj_max[obj_tier][spr], center_dist);
 }
 
-enum OBJ_STATE obj_add(enum SPRITES sprite, int16_t off_x, int16_t off_y, int16_t spd_x, int16_t spd_y) BANKED {
-    uint8_t next = 0xFF;
-    for (uint8_t i = 0; i < MAX_OBJ; i++) {
-        if (!obj_state.objs[i].active) {
-            next = i;
-            break;
-        }
-    }
-    if (next >= MAX_OBJ) {
+void obj_set_tier(enum OBJ_TIER tier) BANKED {
+    obj_tier = tier;
+}
+
+enum OBJ_TIER obj_get_tier(void) BANKED {
+    return obj_tier;
+}
+
+void obj_spawn(void) HOT {
+    // the same start around the ship on all tiers
+    obj_fill(SPR_LIGHT, obj_max[OBJ_TIER_DMG][SPR_LIGHT], INITIAL_DISTANCE);
+    obj_fill(SPR_DARK, obj_max[OBJ_TIER_DMG][SPR_DARK], INITIAL_DISTANCE);
+    obj_fill(SPR_SHOT_LIGHT, obj_max[OBJ_TIER_DMG][SPR_SHOT_LIGHT], INITIAL_DISTANCE);
+    obj_fill(SPR_SHOT_DARK, obj_max[OBJ_TIER_DMG][SPR_SHOT_DARK], INITIAL_DISTANCE);
+
+    // the extra objects of higher tiers start further out
+    obj_respawn_type(SPR_LIGHT, RESPAWN_DISTANCE);
+    obj_respawn_type(SPR_DARK, RESPAWN_DISTANCE);
+    obj_respawn_type(SPR_SHOT_LIGHT, RESPAWN_DISTANCE);
+    obj_respawn_type(SPR_SHOT_DARK, RESPAWN_DISTANCE);
+}
+
+enum OBJ_STATE obj_add(enum SPRITES sprite, int16_t off_x, int16_t off_y, int16_t spd_x, int16_t spd_y) HOT {
+    if ((obj_state.live_cnt >= MAX_OBJ) && (obj_state.dead_cnt == 0)) {
         return OBJ_LIST_FULL;
     }
 
-    if (obj_state.obj_cnt[sprite] >= obj_max[sprite]) {
+    if (obj_state.obj_cnt[sprite] >= obj_max[obj_tier][sprite]) {
         return OBJ_TYPE_FULL;
     }
 
     obj_state.obj_cnt[sprite]++;
 
-    obj_state.objs[next].active = 1;
-    obj_state.objs[next].sprite = sprite;
-    obj_state.objs[next].off_x = off_x << POS_SCALE_OBJS;
-    obj_state.objs[next].off_y = off_y << POS_SCALE_OBJS;
-    obj_state.objs[next].spd_x = spd_x;
-    obj_state.objs[next].spd_y = spd_y;
-    obj_state.objs[next].travel = 0;
-    obj_state.objs[next].frame = 0;
-    obj_state.objs[next].frame_index = 0;
-    obj_state.objs[next].frame_count = 1;
-    obj_state.objs[next].frame_duration = 0;
+    uint8_t next = obj_alloc();
+    obj_state.sprite[next] = sprite;
+    obj_state.off_x[next] = off_x << POS_SCALE_OBJS;
+    obj_state.off_y[next] = off_y << POS_SCALE_OBJS;
+    obj_state.spd_x[next] = spd_x;
+    obj_state.spd_y[next] = spd_y;
+    obj_state.travel[next] = 0;
+    obj_state.frame[next] = 0;
+    obj_state.frame_index[next] = 0;
+    obj_state.frame_count[next] = 1;
+    obj_state.frame_duration[next] = 0;
+
+    grid_link(next);
 
     return OBJ_ADDED;
 }
 
-static uint8_t handle_shot_col(uint8_t shot, uint8_t orb, int32_t *score, uint8_t is_splash) {
-    if ((abs(obj_state.objs[shot].off_x - obj_state.objs[orb].off_x) <= SHOT_RANGE)
-            && (abs(obj_state.objs[shot].off_y - obj_state.objs[orb].off_y) <= SHOT_RANGE)) {
+uint8_t obj_save(struct obj_saved *objs) BANKED {
+    for (uint8_t i = 0; i < obj_state.live_cnt; i++) {
+        objs[i].sprite = obj_state.sprite[i];
+        objs[i].off_x = obj_state.off_x[i];
+        objs[i].off_y = obj_state.off_y[i];
+        objs[i].spd_x = obj_state.spd_x[i];
+        objs[i].spd_y = obj_state.spd_y[i];
+        objs[i].travel = obj_state.travel[i];
+        objs[i].frame = obj_state.frame[i];
+        objs[i].frame_index = obj_state.frame_index[i];
+        objs[i].frame_count = obj_state.frame_count[i];
+        objs[i].frame_duration = obj_state.frame_duration[i];
+    }
+
+    return obj_state.live_cnt;
+}
+
+void obj_load(const struct obj_saved *objs, uint8_t cnt) BANKED {
+    memset(&obj_state, 0, sizeof(struct obj_state));
+
+    for (uint8_t n = 0; n < cnt; n++) {
+        uint8_t i = obj_alloc();
+        obj_state.sprite[i] = objs[n].sprite;
+        obj_state.off_x[i] = objs[n].off_x;
+        obj_state.off_y[i] = objs[n].off_y;
+        obj_state.spd_x[i] = objs[n].spd_x;
+        obj_state.spd_y[i] = objs[n].spd_y;
+        obj_state.travel[i] = objs[n].travel;
+        obj_state.frame[i] = objs[n].frame;
+        obj_state.frame_index[i] = objs[n].frame_index;
+        obj_state.frame_count[i] = objs[n].frame_count;
+        obj_state.frame_duration[i] = objs[n].frame_duration;
+        obj_state.obj_cnt[objs[n].sprite]++;
+        grid_link(i);
+    }
+}
+
+void obj_load_v0(const struct obj_state_v0 *old) BANKED {
+    memset(&obj_state, 0, sizeof(struct obj_state));
+
+    for (uint8_t n = 0; n < MAX_OBJ_V0; n++) {
+        if (!old->objs[n].active) {
+            continue;
+        }
+
+        uint8_t i = obj_alloc();
+        obj_state.sprite[i] = old->objs[n].sprite;
+        obj_state.off_x[i] = old->objs[n].off_x;
+        obj_state.off_y[i] = old->objs[n].off_y;
+        obj_state.spd_x[i] = old->objs[n].spd_x;
+        obj_state.spd_y[i] = old->objs[n].spd_y;
+        obj_state.travel[i] = old->objs[n].travel;
+        obj_state.frame[i] = old->objs[n].frame;
+        obj_state.frame_index[i] = old->objs[n].frame_index;
+        obj_state.frame_count[i] = old->objs[n].frame_count;
+        obj_state.frame_duration[i] = old->objs[n].frame_duration;
+        obj_state.obj_cnt[old->objs[n].sprite]++;
+        grid_link(i);
+    }
+}
+
+static uint8_t handle_shot_col(uint8_t shot, uint8_t orb, struct bcd *score, uint8_t is_splash) {
+    if ((abs(obj_state.off_x[shot] - obj_state.off_x[orb]) <= SHOT_RANGE)
+            && (abs(obj_state.off_y[shot] - obj_state.off_y[orb]) <= SHOT_RANGE)) {
         sample_play(SFX_EXPL_ORB);
 
-        obj_state.objs[orb].active = 0;
+        enum SPRITES orb_sprite = obj_state.sprite[orb];
+        obj_remove(orb);
 
-        obj_state.obj_cnt[obj_state.objs[shot].sprite]--;
-        obj_state.obj_cnt[obj_state.objs[orb].sprite]--;
+        // shot and explosion share a grid list, no need to relink
+        obj_state.obj_cnt[obj_state.sprite[shot]]--;
 
-        obj_state.objs[shot].sprite = SPR_EXPL;
-        obj_state.objs[shot].travel = 0;
-        obj_state.objs[shot].frame = 0;
-        obj_state.objs[shot].frame_index = 0;
-        obj_state.objs[shot].frame_count = 4;
-        obj_state.objs[shot].frame_duration = 4;
+        obj_state.sprite[shot] = SPR_EXPL;
+        obj_state.travel[shot] = 0;
+        obj_state.frame[shot] = 0;
+        obj_state.frame_index[shot] = 0;
+        obj_state.frame_count[shot] = 4;
+        obj_state.frame_duration[shot] = 4;
         obj_state.obj_cnt[SPR_EXPL]++;
 
         // move explosion to center of orb instead of shot
-        obj_state.objs[shot].off_x = obj_state.objs[orb].off_x;
-        obj_state.objs[shot].off_y = obj_state.objs[orb].off_y;
+        obj_state.off_x[shot] = obj_state.off_x[orb];
+        obj_state.off_y[shot] = obj_state.off_y[orb];
+        grid_move(shot);
 
         // also would look kinda cool with shot speed still applied?
-        obj_state.objs[shot].spd_x = 0;
-        obj_state.objs[shot].spd_y = 0;
+        obj_state.spd_x[shot] = 0;
+        obj_state.spd_y[shot] = 0;
 
         if (!is_splash) {
-            obj_respawn_type(obj_state.objs[orb].sprite, RESPAWN_DISTANCE);
+            obj_respawn_type(orb_sprite, RESPAWN_DISTANCE);
         }
 
-        if (obj_state.objs[orb].sprite == SPR_LIGHT) {
-            (*score) += SCORE_LARGE;
+        if (orb_sprite == SPR_LIGHT) {
+            bcd_add(score, SCORE_LARGE);
         } else {
-            (*score) -= SCORE_LARGE;
+            bcd_sub(score, SCORE_LARGE);
         }
 
         return 1;
@@ -194,70 +395,91 @@ static uint8_t handle_shot_col(uint8_t shot, uint8_t orb, int32_t *score, uint8_
     return 0;
 }
 
-int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, int32_t *score, uint8_t *hiwater, uint8_t is_splash) BANKED {
+// test object i against the nearby candidates in the other grid list
+static void check_col(uint8_t i, enum OBJ_GRID_LIST list, struct bcd *score, uint8_t is_splash) {
+    int16_t x = obj_state.off_x[i] >> POS_SCALE_OBJS;
+    uint8_t first = grid_col(x - (SHOT_RANGE >> POS_SCALE_OBJS) - 1);
+    uint8_t last = grid_col(x + (SHOT_RANGE >> POS_SCALE_OBJS) + 1);
+
+    for (uint8_t col = first; col <= last; col++) {
+        for (uint8_t n = obj_state.grid_head[list][col]; n != 0; n = obj_state.grid_next[n - 1]) {
+#ifdef CHECK_COL_AT_SHOTS
+            if (handle_shot_col(i, n - 1, score, is_splash)) {
+                return;
+            }
+#else // CHECK_COL_AT_SHOTS
+            if (obj_state.sprite[n - 1] != SPR_SHOT) {
+                continue;
+            }
+
+            if (handle_shot_col(n - 1, i, score, is_splash)) {
+                return;
+            }
+#endif // CHECK_COL_AT_SHOTS
+        }
+    }
+}
+
+int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, struct bcd *score, uint8_t *hiwater, uint8_t is_splash) HOT {
     int16_t damage = 0;
 
     // initial speed
     int16_t spd_x = *spd_off_x;
     int16_t spd_y = *spd_off_y;
 
-    for (uint8_t i = 0; i < MAX_OBJ; i++) {
-        if (!obj_state.objs[i].active) {
+    // objects spawned in here are appended and still updated
+    for (uint8_t i = 0; i < obj_state.live_cnt; i++) {
+        // hit by an earlier one
+        if (obj_state.grid_col[i] == OBJ_GRID_DEAD) {
             continue;
         }
 
         // move objects by their speed and compensate for movement of the background / ship
-        obj_state.objs[i].off_x = obj_state.objs[i].off_x + obj_state.objs[i].spd_x - spd_x;
-        obj_state.objs[i].off_y = obj_state.objs[i].off_y + obj_state.objs[i].spd_y - spd_y;
+        int16_t off_x = obj_state.off_x[i] + obj_state.spd_x[i] - spd_x;
+        int16_t off_y = obj_state.off_y[i] + obj_state.spd_y[i] - spd_y;
 
-        if (obj_state.objs[i].off_x > POS_OBJS_MAX) {
-            obj_state.objs[i].off_x -= POS_OBJS_MAX - POS_OBJS_MIN + 1;
-        } else if (obj_state.objs[i].off_x < POS_OBJS_MIN) {
-            obj_state.objs[i].off_x += POS_OBJS_MAX - POS_OBJS_MIN + 1;
+        if (off_x > POS_OBJS_MAX) {
+            off_x -= POS_OBJS_MAX - POS_OBJS_MIN + 1;
+        } else if (off_x < POS_OBJS_MIN) {
+            off_x += POS_OBJS_MAX - POS_OBJS_MIN + 1;
         }
-        if (obj_state.objs[i].off_y > POS_OBJS_MAX) {
-            obj_state.objs[i].off_y -= POS_OBJS_MAX - POS_OBJS_MIN + 1;
-        } else if (obj_state.objs[i].off_y < POS_OBJS_MIN) {
-            obj_state.objs[i].off_y += POS_OBJS_MAX - POS_OBJS_MIN + 1;
+        if (off_y > POS_OBJS_MAX) {
+            off_y -= POS_OBJS_MAX - POS_OBJS_MIN + 1;
+        } else if (off_y < POS_OBJS_MIN) {
+            off_y += POS_OBJS_MAX - POS_OBJS_MIN + 1;
         }
 
+        obj_state.off_x[i] = off_x;
+        obj_state.off_y[i] = off_y;
+        grid_move(i);
+
         // only update travel time if we're actually moving
-        if ((obj_state.objs[i].spd_x != 0) || (obj_state.objs[i].spd_y != 0)) {
-            obj_state.objs[i].travel += 1;
+        if ((obj_state.spd_x[i] != 0) || (obj_state.spd_y[i] != 0)) {
+            obj_state.travel[i] += 1;
         }
 
         // remove objects that have traveled for too long
-        if (obj_state.objs[i].travel >= MAX_TRAVEL) {
-            obj_state.objs[i].active = 0;
-            obj_state.obj_cnt[obj_state.objs[i].sprite]--;
+        if (obj_state.travel[i] >= MAX_TRAVEL) {
+            obj_remove(i);
             continue;
         }
 
-        int abs_off_x = abs(obj_state.objs[i].off_x);
-        int abs_off_y = abs(obj_state.objs[i].off_y);
+        int abs_off_x = abs(off_x);
+        int abs_off_y = abs(off_y);
 
         // handle collision
-        switch (obj_state.objs[i].sprite) {
+        switch (obj_state.sprite[i]) {
             case SPR_DARK:
 #ifdef DESPAWN_RANGE
                 if ((abs_off_x >= DESPAWN_RANGE) || (abs_off_y >= DESPAWN_RANGE)) {
-                    objs[i].active = 0;
-                    obj_cnt[SPR_DARK]--;
+                    obj_remove(i);
                     obj_respawn_type(SPR_DARK, RESPAWN_DISTANCE);
                 }
 #endif // DESPAWN_RANGE
 
                 if ((abs_off_x <= GRAVITY_RANGE) && (abs_off_y <= GRAVITY_RANGE)) {
-                    if (obj_state.objs[i].off_x > 0) {
-                        *spd_off_x += (GRAVITY_RANGE - obj_state.objs[i].off_x) >> GRAVITY_SHIFT;
-                    } else if (obj_state.objs[i].off_x < 0) {
-                        *spd_off_x += (-GRAVITY_RANGE - obj_state.objs[i].off_x) >> GRAVITY_SHIFT;
-                    }
-                    if (obj_state.objs[i].off_y > 0) {
-                        *spd_off_y += (GRAVITY_RANGE - obj_state.objs[i].off_y) >> GRAVITY_SHIFT;
-                    } else if (obj_state.objs[i].off_y < 0) {
-                        *spd_off_y += (-GRAVITY_RANGE - obj_state.objs[i].off_y) >> GRAVITY_SHIFT;
-                    }
+                    *spd_off_x += GRAVITY(off_x);
+                    *spd_off_y += GRAVITY(off_y);
                 }
 
                 if ((abs_off_x <= DAMAGE_RANGE) && (abs_off_y <= DAMAGE_RANGE)) {
@@ -265,38 +487,21 @@ int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, int32_t *score, uint8_t *
                 }
 
 #ifndef CHECK_COL_AT_SHOTS
-                for (uint8_t shot = 0; shot < MAX_OBJ; shot++) {
-                    if ((!objs[shot].active) || (objs[shot].sprite != SPR_SHOT)) {
-                        continue;
-                    }
-
-                    if (handle_shot_col(shot, i, score, is_splash)) {
-                        break;
-                    }
-                }
+                check_col(i, OBJ_GRID_OTHER, score, is_splash);
 #endif // ! CHECK_COL_AT_SHOTS
                 break;
 
             case SPR_LIGHT:
 #ifdef DESPAWN_RANGE
                 if ((abs_off_x >= DESPAWN_RANGE) || (abs_off_y >= DESPAWN_RANGE)) {
-                    objs[i].active = 0;
-                    obj_cnt[SPR_LIGHT]--;
+                    obj_remove(i);
                     obj_respawn_type(SPR_LIGHT, RESPAWN_DISTANCE);
                 }
 #endif // DESPAWN_RANGE
 
                 if ((abs_off_x <= GRAVITY_RANGE) && (abs_off_y <= GRAVITY_RANGE)) {
-                    if (obj_state.objs[i].off_x > 0) {
-                        *spd_off_x -= (GRAVITY_RANGE - obj_state.objs[i].off_x) >> GRAVITY_SHIFT;
-                    } else if (obj_state.objs[i].off_x < 0) {
-                        *spd_off_x -= (-GRAVITY_RANGE - obj_state.objs[i].off_x) >> GRAVITY_SHIFT;
-                    }
-                    if (obj_state.objs[i].off_y > 0) {
-                        *spd_off_y -= (GRAVITY_RANGE - obj_state.objs[i].off_y) >> GRAVITY_SHIFT;
-                    } else if (obj_state.objs[i].off_y < 0) {
-                        *spd_off_y -= (-GRAVITY_RANGE - obj_state.objs[i].off_y) >> GRAVITY_SHIFT;
-                    }
+                    *spd_off_x -= GRAVITY(off_x);
+                    *spd_off_y -= GRAVITY(off_y);
                 }
 
                 if ((abs_off_x <= HEALTH_RANGE) && (abs_off_y <= HEALTH_RANGE)) {
@@ -304,31 +509,21 @@ int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, int32_t *score, uint8_t *
                 }
 
 #ifndef CHECK_COL_AT_SHOTS
-                for (uint8_t shot = 0; shot < MAX_OBJ; shot++) {
-                    if ((!objs[shot].active) || (objs[shot].sprite != SPR_SHOT)) {
-                        continue;
-                    }
-
-                    if (handle_shot_col(shot, i, score, is_splash)) {
-                        break;
-                    }
-                }
+                check_col(i, OBJ_GRID_OTHER, score, is_splash);
 #endif // ! CHECK_COL_AT_SHOTS
                 break;
 
             case SPR_SHOT_DARK:
 #ifdef DESPAWN_RANGE
                 if ((abs_off_x >= DESPAWN_RANGE) || (abs_off_y >= DESPAWN_RANGE)) {
-                    objs[i].active = 0;
-                    obj_cnt[SPR_SHOT_DARK]--;
+                    obj_remove(i);
                     obj_respawn_type(SPR_SHOT_DARK, RESPAWN_DISTANCE);
                 }
 #endif // DESPAWN_RANGE
 
                 if ((abs_off_x <= PICKUP_SMALL_RANGE) && (abs_off_y <= PICKUP_SMALL_RANGE)) {
-                    (*score) -= SCORE_SMALL;
-                    obj_state.objs[i].active = 0;
-                    obj_state.obj_cnt[SPR_SHOT_DARK]--;
+                    bcd_sub(score, SCORE_SMALL);
+                    obj_remove(i);
                     obj_respawn_type(SPR_SHOT_DARK, RESPAWN_DISTANCE);
                 }
                 break;
@@ -336,33 +531,21 @@ int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, int32_t *score, uint8_t *
             case SPR_SHOT_LIGHT:
 #ifdef DESPAWN_RANGE
                 if ((abs_off_x >= DESPAWN_RANGE) || (abs_off_y >= DESPAWN_RANGE)) {
-                    objs[i].active = 0;
-                    obj_cnt[SPR_SHOT_LIGHT]--;
+                    obj_remove(i);
                     obj_respawn_type(SPR_SHOT_LIGHT, RESPAWN_DISTANCE);
                 }
 #endif // DESPAWN_RANGE
 
                 if ((abs_off_x <= PICKUP_SMALL_RANGE) && (abs_off_y <= PICKUP_SMALL_RANGE)) {
-                    (*score) += SCORE_SMALL;
-                    obj_state.objs[i].active = 0;
-                    obj_state.obj_cnt[SPR_SHOT_LIGHT]--;
+                    bcd_add(score, SCORE_SMALL);
+                    obj_remove(i);
                     obj_respawn_type(SPR_SHOT_LIGHT, RESPAWN_DISTANCE);
                 }
                 break;
 
 #ifdef CHECK_COL_AT_SHOTS
             case SPR_SHOT:
-                for (uint8_t orb = 0; orb < MAX_OBJ; orb++) {
-                    if ((!obj_state.objs[orb].active)
-                            || ((obj_state.objs[orb].sprite != SPR_LIGHT)
-                                && (obj_state.objs[orb].sprite != SPR_DARK))) {
-                        continue;
-                    }
-
-                    if (handle_shot_col(i, orb, score, is_splash)) {
-                        break;
-                    }
-                }
+                check_col(i, OBJ_GRID_ORBS, score, is_splash);
                 break;
 #endif // CHECK_COL_AT_SHOTS
 
@@ -370,29 +553,41 @@ int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y, int32_t *score, uint8_t *
                 break;
         }
 
-        if (!obj_state.objs[i].active) {
+        // removed by a collision or pickup
+        if (obj_state.grid_col[i] == OBJ_GRID_DEAD) {
             continue;
         }
 
-        spr_draw(obj_state.objs[i].sprite, FLIP_NONE,
-                 obj_state.objs[i].off_x >> POS_SCALE_OBJS,
-                 obj_state.objs[i].off_y >> POS_SCALE_OBJS,
-                 obj_state.objs[i].frame_index, hiwater);
-
-        obj_state.objs[i].frame++;
-        if (obj_state.objs[i].frame >= obj_state.objs[i].frame_duration) {
-            obj_state.objs[i].frame = 0;
-            obj_state.objs[i].frame_index++;
-            if (obj_state.objs[i].frame_index >= obj_state.objs[i].frame_count) {
-                obj_state.objs[i].frame_index = 0;
-
-                if (obj_state.objs[i].sprite == SPR_EXPL) {
-                    obj_state.objs[i].active = 0;
-                    obj_state.obj_cnt[SPR_EXPL]--;
+        spr_draw(obj_state.sprite[i], FLIP_NONE,
+                 obj_state.off_x[i] >> POS_SCALE_OBJS,
+                 obj_state.off_y[i] >> POS_SCALE_OBJS,
+                 obj_state.frame_index[i], hiwater);
+
+        obj_state.frame[i]++;
+        if (obj_state.frame[i] >= obj_state.frame_duration[i]) {
+            obj_state.frame[i] = 0;
+            obj_state.frame_index[i]++;
+            if (obj_state.frame_index[i] >= obj_state.frame_count[i]) {
+                obj_state.frame_index[i] = 0;
+
+                if (obj_state.sprite[i] == SPR_EXPL) {
+                    obj_remove(i);
                 }
             }
         }
     }
 
+    if (obj_state.dead_cnt > 0) {
+        obj_compact();
+    }
+
     return damage;
 }
+
+enum OBJ_STATE obj_add_banked(enum SPRITES sprite, int16_t off_x, int16_t off_y, int16_t spd_x, int16_t spd_y) BANKED {
+    return obj_add(sprite, off_x, off_y, spd_x, spd_y);
+}
+
+int16_t obj_do_banked(int16_t *spd_off_x, int16_t *spd_off_y, struct bcd *score, uint8_t *hiwater, uint8_t is_splash) BANKED {
+    return obj_do(spd_off_x, spd_off_y, score, hiwater, is_splash);
+}
@@ -23,6 +23,8 @@
 #include <gbdk/platform.h>
 #include <stdint.h>
 
+#include "banks.h"
+#include "bcd.h"
 #include "sprites.h"
 
 /*
@@ -44,17 +46,107 @@
  * --> 2x shot & 4x small = 6
  * --> 20 + 6 = 26
  *
- * TODO we will sometimes have glitches
- * 1 sprite tile too much
+ * That is 1 sprite tile too much, but the scheduler
+ * behind spr_draw drops and rotates the overflowing
+ * objects, so more objects only cause more flicker.
  */
 #define MAX_DARK 2
 #define MAX_LIGHT 2
 #define MAX_SHOT 2
 #define MAX_SHOT_DARK 2
 #define MAX_SHOT_LIGHT 2
-#define MAX_OBJ ((4 * MAX_DARK) + (4 * MAX_LIGHT) + MAX_SHOT + MAX_SHOT_DARK + MAX_SHOT_LIGHT)
 
-struct obj {
+/*
+ * The GBC (and GBA) runs the game with the double-speed
+ * CPU, so it has the time for a denser field, at the
+ * cost of more flicker. The pool is sized for the
+ * largest tier, see obj_set_tier().
+ */
+#define MAX_DARK_GBC 3
+#define MAX_LIGHT_GBC 3
+#define MAX_SHOT_GBC 3
+#define MAX_SHOT_DARK_GBC 3
+#define MAX_SHOT_LIGHT_GBC 3
+
+#define MAX_OBJ ((4 * MAX_DARK_GBC) + (4 * MAX_LIGHT_GBC) + MAX_SHOT_GBC + MAX_SHOT_DARK_GBC + MAX_SHOT_LIGHT_GBC)
+
+enum OBJ_TIER {
+    OBJ_TIER_DMG = 0,
+    OBJ_TIER_GBC,
+
+    OBJ_TIER_COUNT
+};
+
+/*
+ * Objects are also sorted into a coarse grid of columns,
+ * keyed on their x position. Collision and placement checks
+ * only have to look at the neighbouring columns then.
+ * Orbs are kept in their own lists, because shots only
+ * ever need to be tested against those.
+ *
+ * Lists hold the object index plus one, zero terminates.
+ * So an all-zero obj_state is also a valid empty grid.
+ */
+#define OBJ_GRID_SHIFT 5 // 32 pixels per column
+#define OBJ_GRID_COLS (256 >> OBJ_GRID_SHIFT)
+
+enum OBJ_GRID_LIST {
+    OBJ_GRID_ORBS = 0,
+    OBJ_GRID_OTHER,
+
+    OBJ_GRID_LISTS
+};
+
+/*
+ * Objects are stored as one array per field. Indexing these
+ * is a lot cheaper for SDCC than the stride of a struct.
+ * The objects are kept dense in the first live_cnt slots, in
+ * update order, so obj_do walks them directly. Spawning takes
+ * the next slot. Removing one in obj_do only marks its grid_col
+ * as OBJ_GRID_DEAD, the gaps are closed after the update loop.
+ * So an all-zero obj_state is also a valid empty pool.
+ */
+#define OBJ_GRID_DEAD 0xFF
+
+struct obj_state {
+    enum SPRITES sprite[MAX_OBJ];
+    int16_t off_x[MAX_OBJ], off_y[MAX_OBJ];
+    int16_t spd_x[MAX_OBJ], spd_y[MAX_OBJ];
+    uint8_t travel[MAX_OBJ];
+    uint8_t frame[MAX_OBJ];
+    uint8_t frame_index[MAX_OBJ];
+    uint8_t frame_count[MAX_OBJ];
+    uint8_t frame_duration[MAX_OBJ];
+    uint8_t obj_cnt[SPRITE_COUNT];
+
+    uint8_t live_cnt; // slots in use, including the dead ones
+    uint8_t dead_cnt; // removed during obj_do, not closed yet
+
+    uint8_t grid_head[OBJ_GRID_LISTS][OBJ_GRID_COLS];
+    uint8_t grid_next[MAX_OBJ];
+    uint8_t grid_col[MAX_OBJ];
+};
+
+/*
+ * Only the live objects go into a save slot, in update order.
+ * The pool bookkeeping and the grid are rebuilt when loading.
+ */
+struct obj_saved {
+    uint8_t sprite; // enum SPRITES
+    int16_t off_x, off_y;
+    int16_t spd_x, spd_y;
+    uint8_t travel;
+    uint8_t frame;
+    uint8_t frame_index;
+    uint8_t frame_count;
+    uint8_t frame_duration;
+};
+
+// pool size of save state version 0
+#define MAX_OBJ_V0 20
+
+// save state layout of version 0, only used for conversion
+struct obj_v0 {
     uint8_t active;
     enum SPRITES sprite;
     int16_t off_x, off_y;
@@ -66,8 +158,8 @@ struct obj {
     uint8_t frame_duration;
 };
 
-struct obj_state {
-    struct obj objs[MAX_OBJ];
+struct obj_state_v0 {
+    struct obj_v0 objs[MAX_OBJ_V0];
     uint8_t obj_cnt[SPRITE_COUNT];
 };
 
@@ -77,14 +169,26 @@ enum OBJ_STATE {
     OBJ_TYPE_FULL,
 };
 
-void obj_spawn(void) BANKED;
+void obj_set_tier(enum OBJ_TIER tier) BANKED;
+enum OBJ_TIER obj_get_tier(void) BANKED;
+
+void obj_spawn(void) HOT;
 
 enum OBJ_STATE obj_add(enum SPRITES sprite,
                        int16_t off_x, int16_t off_y,
-                       int16_t spd_x, int16_t spd_y) BANKED;
+                       int16_t spd_x, int16_t spd_y) HOT;
+enum OBJ_STATE obj_add_banked(enum SPRITES sprite,
+                              int16_t off_x, int16_t off_y,
+                              int16_t spd_x, int16_t spd_y) BANKED;
 
 int16_t obj_do(int16_t *spd_off_x, int16_t *spd_off_y,
-               int32_t *score, uint8_t *hiwater, uint8_t is_splash) BANKED;
+               struct bcd *score, uint8_t *hiwater, uint8_t is_splash) HOT;
+int16_t obj_do_banked(int16_t *spd_off_x, int16_t *spd_off_y,
+                      struct bcd *score, uint8_t *hiwater, uint8_t is_splash) BANKED;
+
+uint8_t obj_save(struct obj_saved *objs) BANKED;
+void obj_load(const struct obj_saved *objs, uint8_t cnt) BANKED;
+void obj_load_v0(const struct obj_state_v0 *old) BANKED;
 
 extern struct obj_state obj_state;
 
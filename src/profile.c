@@ -0,0 +1,155 @@
+/*
+ * profile.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include <gbdk/emu_debug.h>
+#include <string.h>
+
+#include "banks.h"
+#include "sample.h"
+#include "profile.h"
+
+/*
+ * Time is measured in scanlines using LY_REG, so the numbers
+ * are independent of the CPU speed. One frame has 154 lines.
+ * A phase taking longer than a whole frame will wrap around,
+ * but then we already dropped a frame anyway.
+ *
+ * The sample interrupt can not be timed like that, but it takes
+ * a fixed number of cycles per tick. So it is counted from the
+ * ticks of each frame instead.
+ *
+ * A frame can run several fixed steps, each marking its phases.
+ * Those are summed up per frame, saturating at 0xFF.
+ */
+
+#define PROF_LINE_CYCLES 114 // M-cycles per scanline, twice that in double speed
+
+BANKREF(profile)
+
+static uint8_t enabled = 0;
+static uint8_t last_ly = 0;
+static uint8_t hist_pos = 0;
+static uint8_t history[PROF_ALL][PROF_HISTORY];
+
+#ifdef DEBUG
+static const char * const phase_names[PROF_ALL] = {
+    "input",  // PROF_INPUT
+    "map",    // PROF_MAP
+    "status", // PROF_STATUS
+    "ship",   // PROF_SHIP
+    "obj",    // PROF_OBJ
+    "win",    // PROF_WIN
+    "sample", // PROF_SAMPLE
+};
+#endif // DEBUG
+
+void prof_reset(uint8_t enable) BANKED {
+    enabled = enable;
+    last_ly = LY_REG;
+    hist_pos = 0;
+    memset(history, 0, sizeof(history));
+    sample_ticks();
+}
+
+void prof_start(void) NONBANKED {
+    if (!enabled) {
+        return;
+    }
+
+    last_ly = LY_REG;
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        history[i][hist_pos] = 0;
+    }
+}
+
+void prof_mark(enum PROF_PHASE phase) NONBANKED {
+    if (!enabled) {
+        return;
+    }
+
+    uint8_t ly = LY_REG;
+    uint8_t diff;
+    if (ly >= last_ly) {
+        diff = ly - last_ly;
+    } else {
+        diff = ly + PROF_FRAME_LINES - last_ly;
+    }
+
+    uint8_t *h = &history[phase][hist_pos];
+    *h = (*h > (0xFF - diff)) ? 0xFF : (*h + diff);
+    last_ly = ly;
+}
+
+void prof_frame_done(void) NONBANKED {
+    if (!enabled) {
+        return;
+    }
+
+    uint16_t cycles = sample_ticks() * SAMPLE_ISR_CYCLES;
+    uint8_t line = (_cpu == CGB_TYPE) ? (PROF_LINE_CYCLES * 2) : PROF_LINE_CYCLES; // see main()
+    history[PROF_SAMPLE][hist_pos] = (cycles + line - 1) / line;
+
+    hist_pos = (hist_pos + 1) & (PROF_HISTORY - 1);
+}
+
+void prof_stats(enum PROF_PHASE phase, struct prof_stats *s) BANKED {
+    uint16_t sum = 0;
+    s->min = 0xFF;
+    s->max = 0;
+
+    for (uint8_t i = 0; i < PROF_HISTORY; i++) {
+        uint8_t v = history[phase][i];
+        sum += v;
+        if (v < s->min) {
+            s->min = v;
+        }
+        if (v > s->max) {
+            s->max = v;
+        }
+    }
+
+    s->avg = sum / PROF_HISTORY;
+}
+
+uint8_t prof_load(void) BANKED {
+    uint16_t sum = 0;
+    for (uint8_t i = 0; i < PROF_COUNT; i++) {
+        struct prof_stats s;
+        prof_stats(i, &s);
+        sum += s.avg;
+    }
+    return (sum > 0xFF) ? 0xFF : sum;
+}
+
+void prof_report(void) BANKED {
+#ifdef DEBUG
+    if (!enabled) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < PROF_ALL; i++) {
+        struct prof_stats s;
+        prof_stats(i, &s);
+        EMU_printf("%s: %s min=%hu avg=%hu max=%hu\n", __func__, phase_names[i],
+                   (uint8_t)s.min, (uint8_t)s.avg, (uint8_t)s.max);
+    }
+    EMU_printf("%s: load %hu / %hu lines\n", __func__,
+               (uint8_t)prof_load(), (uint8_t)PROF_FRAME_LINES);
+#endif // DEBUG
+}
@@ -0,0 +1,65 @@
+/*
+ * profile.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+// scanlines per frame, including vblank
+#define PROF_FRAME_LINES 154
+
+// needs to be a power of two
+#define PROF_HISTORY 16
+
+enum PROF_PHASE {
+    PROF_INPUT = 0,
+    PROF_MAP,
+    PROF_STATUS,
+    PROF_SHIP,
+    PROF_OBJ,
+    PROF_WIN,
+
+    PROF_COUNT,
+
+    // time in the sample interrupt, already part of the phases above
+    PROF_SAMPLE = PROF_COUNT,
+
+    PROF_ALL
+};
+
+struct prof_stats {
+    uint8_t min;
+    uint8_t avg;
+    uint8_t max;
+};
+
+void prof_reset(uint8_t enable) BANKED;
+void prof_start(void);
+void prof_mark(enum PROF_PHASE phase);
+void prof_frame_done(void);
+
+void prof_stats(enum PROF_PHASE phase, struct prof_stats *s) BANKED;
+uint8_t prof_load(void) BANKED;
+void prof_report(void) BANKED;
+
+BANKREF_EXTERN(profile)
+
+#endif // __PROFILE_H__
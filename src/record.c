@@ -0,0 +1,146 @@
+/*
+ * record.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "obj.h"
+#include "record.h"
+
+#define REC_BANK 1
+
+enum REC_MODE rec_mode = REC_OFF;
+
+static uint16_t rec_len = 0;
+static uint16_t rec_pos = 0;
+static uint8_t rec_left = 0;
+static uint8_t rec_keys = 0;
+static uint8_t rec_step = 1;
+static enum OBJ_TIER rec_prev_tier = OBJ_TIER_COUNT; // restored after a replay
+
+BANKREF(record)
+
+// returns the seed the game has to start with
+uint16_t rec_start(uint16_t seed) BANKED {
+    enum debug_flag flags = conf_get()->debug_flags;
+    rec_mode = REC_OFF;
+
+    SWITCH_RAM(REC_BANK);
+
+    if (flags & DBG_REPLAY) {
+        if ((rec.magic == REC_MAGIC) && (rec.tier < OBJ_TIER_COUNT)) {
+            seed = rec.seed;
+            rec_prev_tier = obj_get_tier();
+            obj_set_tier(rec.tier);
+            rec_pos = 0;
+            rec_left = 0;
+            rec_mode = REC_REPLAY;
+        }
+    } else if (flags & DBG_RECORD) {
+        rec.magic = 0;
+        rec.seed = seed;
+        rec.tier = obj_get_tier();
+        rec_len = 0;
+        rec_mode = REC_RECORD;
+    }
+
+    SWITCH_RAM(0);
+    return seed;
+}
+
+void rec_stop(void) BANKED {
+    if (rec_mode == REC_RECORD) {
+        SWITCH_RAM(REC_BANK);
+        rec.len = rec_len;
+        rec.magic = REC_MAGIC;
+        SWITCH_RAM(0);
+    }
+
+    // also when the replay already ran out during the game
+    if (rec_prev_tier < OBJ_TIER_COUNT) {
+        obj_set_tier(rec_prev_tier);
+        rec_prev_tier = OBJ_TIER_COUNT;
+    }
+
+    rec_mode = REC_OFF;
+}
+
+// called by key_read() for every frame while a mode is active
+uint8_t rec_key(uint8_t keys) NONBANKED {
+    SWITCH_RAM(REC_BANK);
+
+    if (rec_mode == REC_RECORD) {
+        // one step until rec_steps() says otherwise
+        struct rec_run *r = &rec.runs[rec_len];
+        if (rec_len >= REC_RUNS) {
+            // when full the recording simply ends here
+        } else if ((rec_len > 0) && (r[-1].keys == keys) && (r[-1].count < REC_COUNT_MASK)) {
+            r[-1].count++;
+        } else {
+            r->count = 1;
+            r->keys = keys;
+            rec_len++;
+        }
+    } else {
+        while (rec_left == 0) {
+            if (rec_pos >= rec.len) {
+                // back to the real joypad
+                rec_mode = REC_OFF;
+                SWITCH_RAM(0);
+                return keys;
+            }
+
+            rec_left = rec.runs[rec_pos].count & REC_COUNT_MASK;
+            rec_step = (rec.runs[rec_pos].count >> REC_STEPS_SHIFT) + 1;
+            rec_keys = rec.runs[rec_pos].keys;
+            rec_pos++;
+        }
+
+        rec_left--;
+        keys = rec_keys;
+    }
+
+    SWITCH_RAM(0);
+    return keys;
+}
+
+// called by game_steps() after key_read() while a mode is active
+uint8_t rec_steps(uint8_t steps) NONBANKED {
+    if (rec_mode == REC_REPLAY) {
+        return rec_step;
+    }
+
+    if ((steps <= 1) || (rec_len == 0) || (rec_len >= REC_RUNS)) {
+        return steps;
+    }
+
+    SWITCH_RAM(REC_BANK);
+
+    // move the frame from rec_key() into a run of its own
+    struct rec_run *r = &rec.runs[rec_len - 1];
+    if (r->count == 1) {
+        r->count |= (steps - 1) << REC_STEPS_SHIFT;
+    } else {
+        r->count--;
+        r[1].count = 1 | ((steps - 1) << REC_STEPS_SHIFT);
+        r[1].keys = r->keys;
+        rec_len++;
+    }
+
+    SWITCH_RAM(0);
+    return steps;
+}
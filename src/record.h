@@ -0,0 +1,75 @@
+/*
+ * record.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __RECORD_H__
+#define __RECORD_H__
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+/*
+ * Joypad recording in SRAM bank 1, to reproduce a session.
+ * With the record debug flag set, every new game starts from
+ * a fresh seed and all joypad states read during game() are
+ * stored as runs of identical values, together with the number
+ * of fixed steps game_steps() returned for them. With the replay
+ * flag set, the next game starts from the stored seed and object
+ * tier, key_read() returns the recorded values and game_steps()
+ * the recorded steps, until the recording runs out.
+ *
+ * util/rec2sim.py converts a recording for the host simulation.
+ */
+
+#define REC_MAGIC 0xD6
+#define REC_RUNS 4000 // fits in the 8K of bank 1
+
+#define REC_COUNT_MASK 0x3F
+#define REC_STEPS_SHIFT 6 // steps - 1, up to REC_STEPS_MAX
+#define REC_STEPS_MAX 4 // STEP_MAX in game.c
+
+enum REC_MODE {
+    REC_OFF = 0,
+    REC_RECORD,
+    REC_REPLAY,
+};
+
+struct rec_run {
+    uint8_t count; // frames and steps, see REC_COUNT_MASK
+    uint8_t keys;
+};
+
+struct rec_mem {
+    uint8_t magic; // only written once the recording is complete
+    uint16_t seed;
+    uint16_t len;
+    uint8_t tier; // enum OBJ_TIER, changes spawns and the random numbers
+    struct rec_run runs[REC_RUNS];
+};
+
+uint16_t rec_start(uint16_t seed) BANKED;
+void rec_stop(void) BANKED;
+uint8_t rec_key(uint8_t keys);
+uint8_t rec_steps(uint8_t steps);
+
+extern enum REC_MODE rec_mode;
+extern struct rec_mem rec;
+
+BANKREF_EXTERN(record)
+
+#endif // __RECORD_H__
@@ -23,6 +23,8 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "banks.h"
 #include "config.h"
 #include "gb/hardware.h"
@@ -35,36 +37,78 @@
 
 BANKREF(sample)
 
+// wave channel period for 32 samples, 2048 - (65536 * 32 / SAMPLE_RATE)
+#if SAMPLE_RATE == 8192
+#define SAMPLE_FREQ_LO 0x00
+#elif SAMPLE_RATE == 16384
+#define SAMPLE_FREQ_LO 0x80
+#else
+#error "SAMPLE_RATE needs to be 8192 or 16384"
+#endif
+#define SAMPLE_FREQ_HI 0x07
+
+#define SAMPLE_QUEUE_LEN 4
+
+enum SFX_FLAGS {
+    SFX_RETRIGGER = (1 << 0), // restarts itself while playing
+    SFX_EDGE      = (1 << 1), // only when not requested in the previous frame
+};
+
+// played on a tone channel instead, when channel 3 is busy
+struct sfx_tone {
+    uint8_t noise; // channel 4 instead of 2
+    uint8_t len;   // NRx1
+    uint8_t env;   // NRx2
+    uint16_t freq; // NR23 and NR24, or NR43 for noise
+};
+
+struct sfx_queued {
+    enum SFXS sfx;
+    uint8_t ttl; // frames left to wait for channel 3, 0 when free
+};
+
 static enum SFXS play_sfx = SFX_COUNT;
 static uint8_t play_bank = 1;
 static const uint8_t *play_sample = 0;
 static uint16_t play_length = 0;
+static uint8_t play_ticks = 0;
+
+static struct sfx_queued queue[SAMPLE_QUEUE_LEN];
+static uint8_t held = 0;
+static uint8_t held_prev = 0;
 
 struct sfxs {
     uint8_t bank;
-    uint8_t * const smp;
+    const uint8_t * const smp;
     uint16_t len;
+    uint8_t prio; // higher cuts off lower, equal ones wait
+    uint8_t ttl; // frames to wait in the queue, 0 to drop instead
+    uint8_t flags;
+    const struct sfx_tone *tone; // NULL to queue or drop instead
 };
 
-static const struct sfxs sfxs[SFX_COUNT] = {
-    { .bank = BANK(sfx_shoot),     .smp = sfx_shoot,     .len = sfx_shoot_SIZE >> 4 },     // SFX_SHOT
-    { .bank = BANK(sfx_expl_orb),  .smp = sfx_expl_orb,  .len = sfx_expl_orb_SIZE >> 4 },  // SFX_EXPL_ORB
-    { .bank = BANK(sfx_expl_ship), .smp = sfx_expl_ship, .len = sfx_expl_ship_SIZE >> 4 }, // SFX_EXPL_SHIP
-    { .bank = BANK(sfx_damage),    .smp = sfx_damage,    .len = sfx_damage_SIZE >> 4 },    // SFX_DAMAGE
-    { .bank = BANK(sfx_heal),      .smp = sfx_heal,      .len = sfx_heal_SIZE >> 4 },      // SFX_HEAL
+static const struct sfx_tone tone_shot = {
+    .noise = 0, .len = 0xB0, .env = 0x91, .freq = 1750, // 50% duty, short, fading
 };
 
-void sample_play(enum SFXS sfx) BANKED {
-    if (sfx >= SFX_COUNT) {
-        return;
-    }
+static const struct sfx_tone tone_expl_orb = {
+    .noise = 1, .len = 0x20, .env = 0xA2, .freq = 0x55, // medium length, fading
+};
 
-    /*
-    if (conf_get()->sfx_vol == 0) {
-        return;
-    }
-    */
+static const struct sfxs sfxs[SFX_COUNT] = {
+    { .bank = BANK(sfx_shoot),     .smp = sfx_shoot,     .len = sfx_shoot_SIZE >> 4,     // SFX_SHOT
+      .prio = 0, .ttl = 0,  .flags = SFX_RETRIGGER, .tone = &tone_shot },
+    { .bank = BANK(sfx_expl_orb),  .smp = sfx_expl_orb,  .len = sfx_expl_orb_SIZE >> 4,  // SFX_EXPL_ORB
+      .prio = 1, .ttl = 8,  .flags = 0,             .tone = &tone_expl_orb },
+    { .bank = BANK(sfx_expl_ship), .smp = sfx_expl_ship, .len = sfx_expl_ship_SIZE >> 4, // SFX_EXPL_SHIP
+      .prio = 3, .ttl = 30, .flags = 0,             .tone = NULL },
+    { .bank = BANK(sfx_damage),    .smp = sfx_damage,    .len = sfx_damage_SIZE >> 4,    // SFX_DAMAGE
+      .prio = 2, .ttl = 15, .flags = SFX_EDGE,      .tone = NULL },
+    { .bank = BANK(sfx_heal),      .smp = sfx_heal,      .len = sfx_heal_SIZE >> 4,      // SFX_HEAL
+      .prio = 2, .ttl = 15, .flags = SFX_EDGE,      .tone = NULL },
+};
 
+static void sample_start(enum SFXS sfx) {
     CRITICAL {
         play_sfx = sfx;
         play_bank = sfxs[sfx].bank;
@@ -73,112 +117,195 @@ void sample_play(enum SFXS sfx) BANKED {
     }
 }
 
-uint8_t sample_running(void) BANKED {
-    return (play_length > 0) ? 1 : 0;
+static void sample_tone(const struct sfx_tone *t) {
+    // the music takes the channel back with its next note
+    if (t->noise) {
+        NR41_REG = t->len;
+        NR42_REG = t->env;
+        NR43_REG = t->freq;
+        NR44_REG = 0xC0; // trigger and enable length
+    } else {
+        NR21_REG = t->len;
+        NR22_REG = t->env;
+        NR23_REG = t->freq & 0xFF;
+        NR24_REG = 0x80 | 0x40 | ((t->freq >> 8) & 0x07); // trigger, enable length, upper freq bits
+    }
 }
 
-enum SFXS sample_last(void) BANKED {
-    return play_sfx;
-}
+static void sample_queue(enum SFXS sfx) {
+    uint8_t slot = SAMPLE_QUEUE_LEN;
 
-void sample_last_reset(void) BANKED {
-    play_sfx = SFX_COUNT;
-}
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if (queue[i].ttl == 0) {
+            slot = i;
+        } else if (queue[i].sfx == sfx) {
+            slot = i;
+            break;
+        } else if ((slot == SAMPLE_QUEUE_LEN) && (sfxs[queue[i].sfx].prio < sfxs[sfx].prio)) {
+            // full so far, replace something less important
+            slot = i;
+        }
+    }
 
-#if 1
+    if (slot < SAMPLE_QUEUE_LEN) {
+        queue[slot].sfx = sfx;
+        queue[slot].ttl = sfxs[sfx].ttl;
+    }
+}
 
-// TODO C version has a slight 'beep' always? and much worse at lower volumes?
+void sample_play(enum SFXS sfx) HOT {
+    if (sfx >= SFX_COUNT) {
+        return;
+    }
 
-void sample_isr(void) NONBANKED {
-    if (play_length == 0) {
+    /*
+    if (conf_get()->sfx_vol == 0) {
         return;
     }
+    */
+
+    if (sfxs[sfx].flags & SFX_EDGE) {
+        uint8_t bit = 1 << sfx;
+        held |= bit;
+        if (held_prev & bit) {
+            return;
+        }
+    }
+
+    if ((play_length == 0) || (sfxs[sfx].prio > sfxs[play_sfx].prio)) {
+        sample_start(sfx);
+    } else if ((sfx == play_sfx) && (sfxs[sfx].flags & SFX_RETRIGGER)) {
+        sample_start(sfx);
+    } else if (sfxs[sfx].tone) {
+        sample_tone(sfxs[sfx].tone);
+    } else if ((sfx != play_sfx) && (sfxs[sfx].ttl > 0)) {
+        // a repeat of the playing one would only sound twice
+        sample_queue(sfx);
+    }
+}
+
+void sample_update(void) HOT {
+    uint8_t next = SAMPLE_QUEUE_LEN;
+
+    held_prev = held;
+    held = 0;
 
-    NR51_REG = 0xBB; // turn CH3 off in left and right pan
-    NR30_REG = 0x00; // turn DAC off
+    for (uint8_t i = 0; i < SAMPLE_QUEUE_LEN; i++) {
+        if (queue[i].ttl == 0) {
+            continue;
+        }
 
-    START_ROM_BANK(play_bank) {
-        // load waveforms
-        for (uint8_t i = 0; i < 16; i++) {
-            _AUD3WAVERAM[i] = *(play_sample++);
+        queue[i].ttl--;
+        if ((next == SAMPLE_QUEUE_LEN) || (sfxs[queue[i].sfx].prio > sfxs[queue[next].sfx].prio)) {
+            next = i;
         }
-    } END_ROM_BANK
+    }
 
-    NR30_REG = 0x80; // turn DAC on
-    NR31_REG = 0xFE; // length of wave, 2nd shortest
-    NR32_REG = (4 - /*conf_get()->sfx_vol*/0x03) << 5;
-    NR33_REG = 0x00; // low freq bits are zero
-    NR34_REG = 0xC7; // start, no loop, high freq bits are 111
-    NR51_REG = 0xFF; // turn all channels on
+    if ((next < SAMPLE_QUEUE_LEN) && (play_length == 0)) {
+        sample_start(queue[next].sfx);
+        queue[next].ttl = 0;
+    }
+}
 
-    play_length--;
+// keeps the effect that is playing, only forgets the requests
+void sample_reset(void) HOT {
+    memset(queue, 0, sizeof(queue));
+    held = 0;
+    held_prev = 0;
 }
 
-#else
+uint8_t sample_running(void) HOT {
+    return (play_length > 0) ? 1 : 0;
+}
+
+void sample_play_banked(enum SFXS sfx) BANKED {
+    sample_play(sfx);
+}
 
-// TODO ASM version has less beep at full volume, but also beeping at lower volumes?
+uint8_t sample_running_banked(void) BANKED {
+    return sample_running();
+}
+
+uint8_t sample_ticks(void) NONBANKED {
+    uint8_t r;
+    CRITICAL {
+        r = play_ticks;
+        play_ticks = 0;
+    }
+    return r;
+}
 
+/*
+ * Wave RAM can only be written with channel 3 stopped, so it is
+ * muted in NR51 and its DAC is off for the 16 copies. That gap
+ * is what makes the 'beep' at the interrupt rate, so the copy is
+ * unrolled to keep it at 82 M-cycles.
+ *
+ * Cycle counts are in the comments, in M-cycles. A tick loading
+ * the next 32 samples takes SAMPLE_ISR_CYCLES, an idle one 12.
+ */
 void sample_isr(void) NONBANKED NAKED {
     __asm
-        ld hl, #_play_length    ; something left to play?
-        ld a, (hl+)
-        or (hl)
-        ret z
-
-        ld hl, #_play_sample
-        ld a, (hl+)
-        ld h, (hl)
-        ld l, a                 ; HL = current position inside the sample
-
-                                ; load new waveform
-        ld a, (#__current_bank) ; save bank and switch
-        ld e, a
-        ld a, (#_play_bank)
-        ld (_rROMB0), a
-
-        ldh a, (_NR51_REG)
-        ld c, a
-        and #0b10111011
-        ldh (_NR51_REG), a
-
-        xor a
-        ldh (_NR30_REG), a
+        ld hl, #_play_length    ; 3  something left to play?
+        ld a, (hl+)             ; 2
+        or (hl)                 ; 2
+        ret z                   ; 2, 5 when taken
+
+        ld hl, #_play_sample    ; 3
+        ld a, (hl+)             ; 2
+        ld h, (hl)              ; 2
+        ld l, a                 ; 1  HL = current position inside the sample
+
+        ld a, (#__current_bank) ; 4  save bank and switch
+        ld e, a                 ; 1
+        ld a, (#_play_bank)     ; 4
+        ld (_rROMB0), a         ; 4
+
+        ldh a, (_NR51_REG)      ; 3  mute CH3 left and right
+        ld c, a                 ; 1
+        and #0b10111011         ; 2
+        ldh (_NR51_REG), a      ; 3
+
+        xor a                   ; 1  DAC off
+        ldh (_NR30_REG), a      ; 3
 
         .irp ofs,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
-            ld a, (hl+)
-            ldh (__AUD3WAVERAM+ofs), a
+            ld a, (hl+)         ; 2
+            ldh (__AUD3WAVERAM+ofs), a ; 3
         .endm
 
-        ld a, #0x80
-        ldh (_NR30_REG), a
-        ld a, #0xFE             ; length of wave
-        ldh (_NR31_REG), a
-        ld a, #0x20             ; volume
-        ldh (_NR32_REG), a
-        xor a                   ; low freq bits are zero
-        ldh (_NR33_REG), a
-        ld a, #0xC7             ; start; no loop; high freq bits are 111
-        ldh (_NR34_REG), a
-
-        ld a, c
-        ldh (_NR51_REG), a
-
-        ld a, e                 ; restore bank
-        ld (_rROMB0), a
-
-        ld a, l                 ; save current position
-        ld (#_play_sample), a
-        ld a, h
-        ld (#_play_sample+1), a
-
-        ld hl, #_play_length    ; decrement length variable
-        ld a, (hl)
-        sub #1
-        ld (hl+), a
-        ld a, (hl)
-        sbc #0
-        ld (hl), a
-        ret
+        ld a, #0x80             ; 2  DAC on
+        ldh (_NR30_REG), a      ; 3
+        ld a, #0xFE             ; 2  length of wave, 2nd shortest
+        ldh (_NR31_REG), a      ; 3
+        ld a, #0x20             ; 2  volume
+        ldh (_NR32_REG), a      ; 3
+        ld a, #SAMPLE_FREQ_LO   ; 2  low freq bits
+        ldh (_NR33_REG), a      ; 3
+        ld a, #(0xC0 | SAMPLE_FREQ_HI) ; 2  start, no loop, high freq bits
+        ldh (_NR34_REG), a      ; 3
+
+        ld a, c                 ; 1  restore panning
+        ldh (_NR51_REG), a      ; 3
+
+        ld a, e                 ; 1  restore bank
+        ld (_rROMB0), a         ; 4
+
+        ld a, l                 ; 1  save current position
+        ld (#_play_sample), a   ; 4
+        ld a, h                 ; 1
+        ld (#_play_sample+1), a ; 4
+
+        ld hl, #_play_length    ; 3  decrement length variable
+        ld a, (hl)              ; 2
+        sub #1                  ; 2
+        ld (hl+), a             ; 2
+        ld a, (hl)              ; 2
+        sbc #0                  ; 2
+        ld (hl), a              ; 2
+
+        ld hl, #_play_ticks     ; 3  for the profiler
+        inc (hl)                ; 3
+        ret                     ; 4
     __endasm;
 }
-#endif
@@ -22,6 +22,20 @@
 
 #include <gbdk/platform.h>
 
+#include "banks.h"
+
+/*
+ * Samples are streamed through the 32 entries of wave RAM, which
+ * the timer interrupt reloads. Build with SAMPLE_RATE=16384 for
+ * twice the rate, at twice the interrupt cost.
+ */
+#ifndef SAMPLE_RATE
+#define SAMPLE_RATE 8192
+#endif
+
+#define SAMPLE_TICK_HZ (SAMPLE_RATE / 32)
+#define SAMPLE_ISR_CYCLES 192 // M-cycles per tick loading samples, see sample.c
+
 enum SFXS {
     SFX_SHOT = 0,
     SFX_EXPL_ORB,
@@ -32,11 +46,21 @@ enum SFXS {
     SFX_COUNT
 };
 
-void sample_play(enum SFXS sfx) BANKED;
-uint8_t sample_running(void) BANKED;
-enum SFXS sample_last(void) BANKED;
-void sample_last_reset(void) BANKED;
+/*
+ * Effects with a higher priority cut off lower ones. Others wait
+ * in a short queue, play as a tone on another channel, or get
+ * dropped, see sfxs in sample.c. sample_update() runs the queue
+ * once per frame, sample_reset() empties it when that stops.
+ */
+void sample_play(enum SFXS sfx) HOT;
+void sample_update(void) HOT;
+void sample_reset(void) HOT;
+uint8_t sample_running(void) HOT;
+
+void sample_play_banked(enum SFXS sfx) BANKED;
+uint8_t sample_running_banked(void) BANKED;
 
+uint8_t sample_ticks(void);
 void sample_isr(void);
 
 BANKREF_EXTERN(sample)
@@ -29,27 +29,27 @@ BANKREF(score)
 #define NAME(a, b, c) (((uint16_t)(a - 'a') << 10) | ((uint16_t)(b - 'a') << 5) | (uint16_t)(c - 'a'))
 
 static const struct scores initial_scores[SCORE_NUM * 2] = {
-    //{ .name = NAME('a', 'd', 'z'), .score = 10000 },
-    //{ .name = NAME('c', 'a', 'n'), .score = 7500 },
-    //{ .name = NAME('i', 'm', 'y'), .score = 5000 },
-    //{ .name = NAME('w', 'i', 'l'), .score = 2500 },
-    { .name = NAME('d', 'b', 'p'), .score = 1000 },
-    { .name = NAME('d', 'a', 'v'), .score = 750 },
-    { .name = NAME('d', 'o', 'd'), .score = 500 },
-    //{ .name = NAME('n', 'f', '.'), .score = 250 },
-    { .name = NAME('k', 'm', 'b'), .score = 175 },
-    { .name = NAME('s', 'j', 'l'), .score = 100 },
-
-    { .name = NAME('j', 'u', 'd'), .score = -100 },
-    //{ .name = NAME('1', '0', '1'), .score = -175 },
-    { .name = NAME('g', 'a', 'z'), .score = -250 },
-    { .name = NAME('n', 'o', 'n'), .score = -500 },
-    { .name = NAME('l', 'r', 'g'), .score = -750 },
-    { .name = NAME('d', 'a', 'n'), .score = -1000 },
-    //{ .name = NAME('w', 'd', 'y'), .score = -2500 },
-    //{ .name = NAME('s', 'i', 's'), .score = -5000 },
-    //{ .name = NAME('k', 'r', 'y'), .score = -7500 },
-    //{ .name = NAME('d', 'j', '.'), .score = -10000 },
+    //{ .name = NAME('a', 'd', 'z'), .score = BCD(10000) },
+    //{ .name = NAME('c', 'a', 'n'), .score = BCD(7500) },
+    //{ .name = NAME('i', 'm', 'y'), .score = BCD(5000) },
+    //{ .name = NAME('w', 'i', 'l'), .score = BCD(2500) },
+    { .name = NAME('d', 'b', 'p'), .score = BCD(1000) },
+    { .name = NAME('d', 'a', 'v'), .score = BCD(750) },
+    { .name = NAME('d', 'o', 'd'), .score = BCD(500) },
+    //{ .name = NAME('n', 'f', '.'), .score = BCD(250) },
+    { .name = NAME('k', 'm', 'b'), .score = BCD(175) },
+    { .name = NAME('s', 'j', 'l'), .score = BCD(100) },
+
+    { .name = NAME('j', 'u', 'd'), .score = BCD(-100) },
+    //{ .name = NAME('1', '0', '1'), .score = BCD(-175) },
+    { .name = NAME('g', 'a', 'z'), .score = BCD(-250) },
+    { .name = NAME('n', 'o', 'n'), .score = BCD(-500) },
+    { .name = NAME('l', 'r', 'g'), .score = BCD(-750) },
+    { .name = NAME('d', 'a', 'n'), .score = BCD(-1000) },
+    //{ .name = NAME('w', 'd', 'y'), .score = BCD(-2500) },
+    //{ .name = NAME('s', 'i', 's'), .score = BCD(-5000) },
+    //{ .name = NAME('k', 'r', 'y'), .score = BCD(-7500) },
+    //{ .name = NAME('d', 'j', '.'), .score = BCD(-10000) },
 };
 
 uint16_t convert_name(char a, char b, char c) BANKED {
@@ -71,16 +71,17 @@ uint16_t convert_name(char a, char b, char c) BANKED {
     return (a << 10) | (b << 5) | c;
 }
 
-static uint8_t score_pos(int32_t score) {
-    if (score > 0) {
+static uint8_t score_pos(const struct bcd *score) {
+    int8_t sign = bcd_sign(score);
+    if (sign > 0) {
         for (uint8_t i = 0; i < SCORE_NUM; i++) {
-            if (score > conf_scores()[i].score) {
+            if (bcd_cmp(score, &conf_scores()[i].score) > 0) {
                 return i;
             }
         }
-    } else if (score < 0) {
+    } else if (sign < 0) {
         for (uint8_t i = (SCORE_NUM * 2) - 1; i >= 5; i--) {
-            if (score < conf_scores()[i].score) {
+            if (bcd_cmp(score, &conf_scores()[i].score) < 0) {
                 return i;
             }
         }
@@ -89,17 +90,19 @@ static uint8_t score_pos(int32_t score) {
     return 0xFF;
 }
 
-uint8_t score_ranking(int32_t score) BANKED {
+uint8_t score_ranking(const struct bcd *score) BANKED {
     return (score_pos(score) < (SCORE_NUM * 2)) ? 1 : 0;
 }
 
 void score_add(struct scores score) BANKED {
-    uint8_t new = score_pos(score.score);
+    uint8_t new = score_pos(&score.score);
     if (new < (SCORE_NUM * 2)) {
+        int8_t sign = bcd_sign(&score.score);
+
         // move old scores out of the way
-        if ((score.score > 0) && (new < (SCORE_NUM - 1))) {
+        if ((sign > 0) && (new < (SCORE_NUM - 1))) {
             memmove(conf_scores() + new + 1, conf_scores() + new, sizeof(struct scores) * (SCORE_NUM - 1 - new));
-        } else if ((score.score < 0) && (new > SCORE_NUM)) {
+        } else if ((sign < 0) && (new > SCORE_NUM)) {
             memmove(conf_scores() + new - 1, conf_scores() + new, sizeof(struct scores) * (new - SCORE_NUM));
         }
 
@@ -107,8 +110,8 @@ void score_add(struct scores score) BANKED {
         conf_write_crc();
 
 #ifdef DEBUG
-        EMU_printf("%s: add %li at %hu for %x\n",
-                   __func__, (int32_t)score.score,
+        EMU_printf("%s: add %hx%hx%hx%hx at %hu for %x\n",
+                   __func__, score.score.d[3], score.score.d[2], score.score.d[1], score.score.d[0],
                    (uint8_t)new, (uint16_t)score.name);
 #endif // DEBUG
     }
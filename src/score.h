@@ -23,15 +23,23 @@
 #include <gbdk/platform.h>
 #include <stdint.h>
 
+#include "bcd.h"
+
 #define SCORE_NUM 5
 
 struct scores {
+    uint16_t name;
+    struct bcd score;
+};
+
+// save state layout of version 0, only used for conversion
+struct scores_v0 {
     uint16_t name;
     int32_t score;
 };
 
 uint16_t convert_name(char a, char b, char c) BANKED;
-uint8_t score_ranking(int32_t score) BANKED;
+uint8_t score_ranking(const struct bcd *score) BANKED;
 void score_add(struct scores score) BANKED;
 void score_highest(uint8_t off, struct scores *t) BANKED;
 void score_lowest(uint8_t off, struct scores *t) BANKED;
@@ -10,6 +10,8 @@
 #include <gb/sgb.h>
 #include <string.h>
 
+#include "lz.h"
+
 #define SGB_CHR_BLOCK0 0
 #define SGB_CHR_BLOCK1 1
 
@@ -48,17 +50,18 @@ void set_sgb_border(const uint8_t *tiledata, size_t tiledata_size,
 
     // transfer tile data
     uint8_t ntiles = (tiledata_size > 256 * 32) ? 0 : tiledata_size >> 5;
+    lz_begin(tiledata, CURRENT_BANK);
     if ((!ntiles) || (ntiles > 128U)) {
-        set_bkg_data(0, 0, tiledata);
+        lz_bkg_data(0, 256);
         SGB_TRANSFER((SGB_CHR_TRN << 3) | 1, SGB_CHR_BLOCK0);
         if (ntiles) ntiles -= 128U;
-        tiledata += (128 * 32);
-        set_bkg_data(0, ntiles << 1, tiledata);
+        lz_bkg_data(0, ntiles ? (ntiles << 1) : 256);
         SGB_TRANSFER((SGB_CHR_TRN << 3) | 1, SGB_CHR_BLOCK1);
     } else {
-        set_bkg_data(0, ntiles << 1, tiledata);
+        lz_bkg_data(0, ntiles << 1);
         SGB_TRANSFER((SGB_CHR_TRN << 3) | 1, SGB_CHR_BLOCK0);
     }
+    lz_report();
 
     // transfer map and palettes
     set_bkg_data(0, (uint8_t)(tilemap_size >> 4), tilemap);
@@ -16,6 +16,10 @@
     The display must be turned on before calling this function
     (with @ref DISPLAY_ON).
 
+    The tile data is compressed by util/lzcomp.py, from the bank
+    mapped at the time of the call. tiledata_size is the size
+    before compression.
+
     When using the SGB with a PAL SNES, a delay should be added
     just after program startup such as:
 
@@ -28,87 +28,72 @@
 #include "banks.h"
 #include "config.h"
 #include "timer.h"
-#include "util.h"
-#include "sound_menu.h"
-#include "sound_game.h"
-#include "sound_over.h"
+#include "music_menu.h"
+#include "music_game.h"
+#include "music_over.h"
 #include "sound.h"
 
 BANKREF(sound)
 
-const uint16_t frequencies[SILENCE] = {
-      44,  156,  262,  363,  457,  547,  631,  710,  786,  854,  923,  986, //  0 .. 11
-    1046, 1102, 1155, 1205, 1253, 1297, 1339, 1379, 1417, 1452, 1486, 1517, // 12 .. 23
-    1546, 1575, 1602, 1627, 1650, 1673, 1694, 1714, 1732, 1750, 1767, 1783, // 24 .. 35
-    1798, 1812, 1825, 1837, 1849, 1860, 1871, 1881, 1890, 1899, 1907, 1915, // 36 .. 47
-    1923, 1930, 1936, 1943, 1949, 1954, 1959, 1964, 1969, 1974, 1978, 1982, // 48 .. 59
-    1985, 1988, 1992, 1995, 1998, 2001, 2004, 2006, 2009, 2011, 2013, 2015  // 60 .. 71
+#define SND_TICK (TIMER_HZ / 256) // timer_get() units per snd_play() call
+#define SND_NOISE (SND_CHANNELS - 1)
+
+#define NIB_REST 0x0D
+#define NIB_WAIT 0x0E
+#define EXT_NOTE 0x0E
+#define EXT_END  0x0F
+
+struct snd_chan {
+    const uint8_t *order; // NULL when done
+    const uint8_t *pos;
+    uint8_t low; // next nibble is the low one of *pos
+    uint8_t wait; // steps until the next event
+    uint8_t instr;
 };
 
-static volatile struct music const * music = NULL;
+static struct song const * volatile music = NULL;
 static volatile uint8_t bank;
-static volatile uint8_t duration;
-static volatile uint16_t off = 0;
-static volatile uint16_t last_t = 0;
+static uint8_t vol = 0;
+static uint16_t step;
+static int16_t left;
+static struct snd_chan chans[SND_CHANNELS];
 
 struct snds {
     uint8_t bank;
-    struct music const * snd;
+    struct song const * snd;
 };
 
 static const struct snds snds[SND_COUNT] = {
-    { .bank = BANK(sound_menu), .snd = &music_menu }, // SND_MENU
-    { .bank = BANK(sound_game), .snd = &music_game }, // SND_GAME
-    { .bank = BANK(sound_over), .snd = &music_over }, // SND_GAMEOVER
+    { .bank = BANK(music_menu), .snd = &music_menu }, // SND_MENU
+    { .bank = BANK(music_game), .snd = &music_game }, // SND_GAME
+    { .bank = BANK(music_over), .snd = &music_over }, // SND_GAMEOVER
 };
 
-#define CALL_FREQ_HZ 256
-
-static void play_note(enum notes note) NONBANKED {
-    if (note < SILENCE) {
-        uint16_t freq;
-        START_ROM_BANK(BANK(sound)) {
-            freq = frequencies[note];
-        } END_ROM_BANK
-
-        NR11_REG = 0x80 | duration; // 50% duty, higher value is shorter time (up to 0x3F)
-        NR12_REG = (conf_get()->music_vol << 4) | 0x00; // given volume, no change
-        NR13_REG = freq & 0xFF; // given frequency
-        NR14_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07); // trigger, enable length, upper freq bits
-    }
-}
-
-static void play_note2(enum notes note) NONBANKED {
-    if (note < SILENCE) {
-        uint16_t freq;
-        START_ROM_BANK(BANK(sound)) {
-            freq = frequencies[note];
-        } END_ROM_BANK
-
-        NR21_REG = 0x80 | duration; // 50% duty, higher value is shorter time (up to 0x3F)
-        NR22_REG = (conf_get()->music_vol << 4) | 0x00; // given volume, no change
-        NR23_REG = freq & 0xFF; // given frequency
-        NR24_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07); // trigger, enable length, upper freq bits
-    }
-}
-
-static void play_drum(enum drums drum) NONBANKED {
-    switch (drum) {
-        case dKick:
-            NR41_REG = 0x2F; // length timer, higher value is shorter time (up to 0x3F)
-            NR42_REG = (conf_get()->music_vol << 4) | 0x00; // initially full volume, no volume changes over time
-            NR43_REG = 0x11; // frequency distribution
-            NR44_REG = 0xC0; // trigger and enable length
+// only called from snd_play(), with the bank of the song mapped
+static void snd_trigger(uint8_t ch, uint8_t note) NONBANKED {
+    uint16_t freq = music->notes[ch][note];
+    const struct snd_instr *in = &music->instr[(ch == SND_NOISE) ? freq : chans[ch].instr];
+
+    switch (ch) {
+        case 0:
+            NR11_REG = in->length; // duty, higher value is shorter time (up to 0x3F)
+            NR12_REG = vol | in->env; // given volume and envelope
+            NR13_REG = freq & 0xFF; // given frequency
+            NR14_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07); // trigger, enable length, upper freq bits
             break;
 
-        case dSnare:
-            NR41_REG = 0x10; // length timer, higher value is shorter time (up to 0x3F)
-            NR42_REG = (conf_get()->music_vol << 4) | 0x02; // initially full volume, then fade sound out
-            NR43_REG = 0x46; // frequency distribution
-            NR44_REG = 0xC0; // trigger and enable length
+        case 1:
+            NR21_REG = in->length;
+            NR22_REG = vol | in->env;
+            NR23_REG = freq & 0xFF;
+            NR24_REG = 0x80 | 0x40 | ((freq >> 8) & 0x07);
             break;
 
-        default:
+        case SND_NOISE:
+            NR41_REG = in->length; // length timer, higher value is shorter time (up to 0x3F)
+            NR42_REG = vol | in->env;
+            NR43_REG = in->poly; // frequency distribution
+            NR44_REG = 0xC0; // trigger and enable length
             break;
     }
 }
@@ -131,16 +116,55 @@ void snd_music_off(void) BANKED {
 }
 
 void snd_note_off(void) BANKED {
-    play_note(SILENCE);
-    play_note2(SILENCE);
+    // turning off the DAC silences the pulse channels, drums fade out on their own
+    NR12_REG = 0x00;
+    NR22_REG = 0x00;
+}
+
+void snd_volume(void) BANKED {
+    vol = conf_get()->music_vol << 4;
 }
 
-static uint16_t snd_duration(enum SOUNDS snd) NONBANKED {
-    uint16_t r;
-    START_ROM_BANK(snds[snd].bank) {
-        r = snds[snd].snd->duration;
+static uint8_t snd_nibble(struct snd_chan *c) NONBANKED {
+    uint8_t n;
+    if (c->low) {
+        n = *(c->pos++) & 0x0F;
+    } else {
+        n = *(c->pos) >> 4;
+    }
+    c->low ^= 1;
+    return n;
+}
+
+// moves on to the next pattern, zero when the channel is done
+static uint8_t snd_pattern(struct song const *snd, uint8_t ch) NONBANKED {
+    struct snd_chan *c = &chans[ch];
+
+    if (*c->order == SND_ORDER_END) {
+        if (snd->loop[ch] == SND_NO_LOOP) {
+            c->order = NULL;
+            return 0;
+        }
+        c->order = snd->order[ch] + snd->loop[ch];
+    }
+
+    c->pos = snd->patterns[*(c->order++)];
+    c->low = 0;
+    return 1;
+}
+
+static void snd_start(uint8_t b, struct song const *snd) NONBANKED {
+    START_ROM_BANK(b) {
+        for (uint8_t ch = 0; ch < SND_CHANNELS; ch++) {
+            chans[ch].order = snd->order[ch];
+            chans[ch].wait = 0;
+            chans[ch].instr = 0;
+            if (chans[ch].order) {
+                snd_pattern(snd, ch);
+            }
+        }
+        step = snd->step;
     } END_ROM_BANK
-    return r;
 }
 
 void snd_music(enum SOUNDS snd) BANKED {
@@ -148,12 +172,13 @@ void snd_music(enum SOUNDS snd) BANKED {
         return;
     }
 
+    snd_volume();
+
     CRITICAL {
-        music = snds[snd].snd;
         bank = snds[snd].bank;
-        duration = 0x3F - MIN((snd_duration(snd) >> 2) + 1, 0x3F);
-        off = 0;
-        last_t = timer_get();
+        snd_start(bank, snds[snd].snd);
+        left = step;
+        music = snds[snd].snd;
     }
 }
 
@@ -162,58 +187,56 @@ void snd_play(void) NONBANKED {
         return;
     }
 
+    left -= SND_TICK;
+    if (left > 0) {
+        return;
+    }
+    left += step;
+
     START_ROM_BANK(bank) {
-        uint16_t diff = timer_get() - last_t;
-        if (diff >= music->duration) {
-            if (music->notes) {
-                if (music->notes[off] != END) {
-                    play_note(music->notes[off]);
-                } else {
-                    if (music->repeat != MUSIC_NO_REPEAT) {
-                        off = music->repeat;
-                        snd_play();
-                        goto end;
-                    } else {
-                        music = NULL;
-                        goto end;
-                    }
-                }
+        uint8_t playing = 0;
+
+        for (uint8_t ch = 0; ch < SND_CHANNELS; ch++) {
+            struct snd_chan *c = &chans[ch];
+            if (!c->order) {
+                continue;
             }
+            playing = 1;
 
-            if (music && music->notes2) {
-                if (music->notes2[off] != END) {
-                    play_note2(music->notes2[off]);
-                } else {
-                    if (music->repeat != MUSIC_NO_REPEAT) {
-                        off = music->repeat;
-                        snd_play();
-                        goto end;
-                    } else {
-                        music = NULL;
-                        goto end;
-                    }
-                }
+            if (c->wait) {
+                c->wait--;
+                continue;
             }
 
-            if (music && music->drums) {
-                if (music->drums[off] != dEND) {
-                    play_drum(music->drums[off]);
-                } else {
-                    if (music->repeat != MUSIC_NO_REPEAT) {
-                        off = music->repeat;
-                        snd_play();
-                        goto end;
-                    } else {
-                        music = NULL;
-                        goto end;
-                    }
+            // at most an instrument, the end of a pattern and one more instrument before a step
+            while (1) {
+                uint8_t n = snd_nibble(c);
+                if (n < NIB_REST) {
+                    snd_trigger(ch, n);
+                    break;
+                } else if (n == NIB_REST) {
+                    break;
+                } else if (n == NIB_WAIT) {
+                    c->wait = snd_nibble(c) + 1;
+                    break;
                 }
-            }
 
-            off++;
-            last_t += music->duration;
+                n = snd_nibble(c);
+                if (n < EXT_NOTE) {
+                    c->instr = n;
+                } else if (n == EXT_NOTE) {
+                    n = snd_nibble(c) << 4;
+                    n |= snd_nibble(c);
+                    snd_trigger(ch, n);
+                    break;
+                } else if (!snd_pattern(music, ch)) {
+                    break;
+                }
+            }
         }
 
-end:
+        if (!playing) {
+            music = NULL;
+        }
     } END_ROM_BANK
 }
@@ -21,52 +21,34 @@
 #define __SOUND_H__
 
 #include <gbdk/platform.h>
+#include <stdint.h>
 
-enum notes {
-    C0 = 0, Cd0, D0, Dd0, E0, F0, Fd0, G0, Gd0, A0, Ad0, B0, //  0 .. 11
-    C1,     Cd1, D1, Dd1, E1, F1, Fd1, G1, Gd1, A1, Ad1, B1, // 12 .. 23
-    C2,     Cd2, D2, Dd2, E2, F2, Fd2, G2, Gd2, A2, Ad2, B2, // 24 .. 35
-    C3,     Cd3, D3, Dd3, E3, F3, Fd3, G3, Gd3, A3, Ad3, B3, // 36 .. 47
-    C4,     Cd4, D4, Dd4, E4, F4, Fd4, G4, Gd4, A4, Ad4, B4, // 48 .. 59
-    C5,     Cd5, D5, Dd5, E5, F5, Fd5, G5, Gd5, A5, Ad5, B5, // 60 .. 71
-    SILENCE, END, SIL = SILENCE,                             // 72 .. 73
-
-              Db0 = Cd0, Eb0 = Dd0, Ed0 = F0,
-    Fb0 = E0, Gb0 = Fd0, Ab0 = Gd0, Bb0 = Ad0,
-
-    Cb1 = B0, Db1 = Cd1, Eb1 = Dd1, Ed1 = F1,
-    Fb1 = E1, Gb1 = Fd1, Ab1 = Gd1, Bb1 = Ad1,
-
-    Cb2 = B1, Db2 = Cd2, Eb2 = Dd2, Ed2 = F2,
-    Fb2 = E2, Gb2 = Fd2, Ab2 = Gd2, Bb2 = Ad2,
-
-    Cb3 = B2, Db3 = Cd3, Eb3 = Dd3, Ed3 = F3,
-    Fb3 = E3, Gb3 = Fd3, Ab3 = Gd3, Bb3 = Ad3,
-
-    Cb4 = B3, Db4 = Cd4, Eb4 = Dd4, Ed4 = F4,
-    Fb4 = E4, Gb4 = Fd4, Ab4 = Gd4, Bb4 = Ad4,
-
-    Cb5 = B4, Db5 = Cd5, Eb5 = Dd5, Ed5 = F5,
-    Fb5 = E5, Gb5 = Fd5, Ab5 = Gd5, Bb5 = Ad5,
-};
+/*
+ * Songs are converted from the .song files in data/ by util/cvtsong.py.
+ * Every channel plays an order list of patterns, which are shared
+ * between channels and stored only once. Patterns are streams of
+ * 4 bit events, see there for the format. Notes are indices into
+ * the note table of the channel, so the player never leaves the
+ * bank of the song.
+ */
 
-enum drums {
-    dKick = 0, dSnare,
-    dSilence,
+#define SND_CHANNELS 3 // both pulse channels and noise
+#define SND_ORDER_END 0xFF
+#define SND_NO_LOOP 0xFF
 
-    dKi = dKick, dSn = dSnare,
-    dSI = dSilence,
-    dEND,
+struct snd_instr {
+    uint8_t length; // NRx1, duty and length timer
+    uint8_t env;    // low nibble of NRx2, envelope direction and pace
+    uint8_t poly;   // NR43, only used on the noise channel
 };
 
-#define MUSIC_NO_REPEAT 0xFFFF
-
-struct music {
-    enum notes * const notes;
-    enum notes * const notes2;
-    enum drums * const drums;
-    uint16_t duration;
-    uint16_t repeat;
+struct song {
+    const uint8_t * const order[SND_CHANNELS]; // ends with SND_ORDER_END, NULL when unused
+    const uint16_t * const notes[SND_CHANNELS]; // frequencies, instruments on noise
+    const uint8_t * const * const patterns;
+    const struct snd_instr * const instr;
+    uint16_t step; // in timer_get() units
+    uint8_t loop[SND_CHANNELS]; // index into order, or SND_NO_LOOP
 };
 
 enum SOUNDS {
@@ -81,6 +63,7 @@ void snd_init(void) BANKED;
 void snd_music_off(void) BANKED;
 void snd_note_off(void) BANKED;
 void snd_music(enum SOUNDS snd) BANKED;
+void snd_volume(void) BANKED;
 
 void snd_play(void);
 
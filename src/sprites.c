@@ -20,22 +20,108 @@
  * See <http://www.gnu.org/licenses/>.
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "banks.h"
 #include "sprite_data.h"
+#include "lz.h"
+#include "obj.h"
+#include "vram.h"
+
+/*
+ * While the scheduler is active, spr_draw only queues the
+ * requests. spr_sched_end then places them in priority order.
+ * Ship, status bars and markers are pinned, everything else
+ * is dropped when it doesn't fit, or when the queue is full.
+ * After an overflow the start of each priority class rotates,
+ * so dropped objects flicker instead of disappearing.
+ */
+
+#define SPR_QUEUE_LEN (MAX_OBJ + SPR_GAME_EXTRA)
+#define SPR_LINE_MAX 10 // hardware limit of sprites per scanline
+#define SPR_BANDS (DEVICE_SCREEN_PX_HEIGHT / 8)
+
+enum SPR_PRIO {
+    PRIO_PINNED = 0,
+    PRIO_HIGH,
+    PRIO_LOW,
+
+    PRIO_COUNT
+};
+
+struct spr_req {
+    enum SPRITES sprite;
+    enum SPRITE_FLIP flip;
+    int8_t x_off;
+    int8_t y_off;
+    uint8_t frame;
+};
+
+static const uint8_t spr_prio[SPRITE_COUNT] = {
+    PRIO_PINNED, // SPR_SHIP
+    PRIO_HIGH, // SPR_LIGHT
+    PRIO_HIGH, // SPR_DARK
+    PRIO_LOW, // SPR_SHOT
+    PRIO_LOW, // SPR_SHOT_LIGHT
+    PRIO_LOW, // SPR_SHOT_DARK
+    PRIO_PINNED, // SPR_HEALTH
+    PRIO_PINNED, // SPR_POWER
+    PRIO_LOW, // SPR_EXPL
+    PRIO_PINNED, // SPR_PAUSE
+    PRIO_PINNED, // SPR_DEBUG
+    PRIO_PINNED, // SPR_DEBUG_LARGE
+};
+
+static_assert(SPR_QUEUE_LEN <= 0xFF, "queue indices are uint8_t");
+
+static uint8_t sched_on = 0;
+static uint8_t sched_rot = 0;
+static uint8_t queue_len = 0;
+static uint8_t queue_over = 0; // requests that found the queue full
+static struct spr_req queue[SPR_QUEUE_LEN];
+static uint8_t prio_list[PRIO_COUNT][SPR_QUEUE_LEN];
+static uint8_t prio_len[PRIO_COUNT];
+static uint8_t band_cnt[SPR_BANDS];
+
+// source of the dynamic palettes, per hardware palette slot
+#define SPR_PALETTES 8
+static uint8_t pal_sprite[SPR_PALETTES];
+static uint8_t pal_index[SPR_PALETTES];
+
+/*
+ * Second shadow OAM for double buffering. The OAM DMA can only
+ * copy from the start of a page, so this has to be placed at a
+ * fixed address. It sits between the globals in WRAM and the
+ * stack at the top. The linker does not know about it, so the
+ * Makefile checks the map file with util/check_ram.py.
+ */
+#ifndef SPR_OAM2_ADDR
+#define SPR_OAM2_ADDR 0xDC00
+#endif
+
+static_assert((SPR_OAM2_ADDR & 0xFF) == 0, "OAM DMA copies whole pages");
+
+static volatile struct OAM_item_t __at(SPR_OAM2_ADDR) shadow_OAM2[MAX_HARDWARE_SPRITES];
+
+#define OAM_PAGE(x) ((uint8_t)((uint16_t)(x) >> 8))
 
 void spr_init(void) NONBANKED {
+    memset(pal_sprite, SPRITE_COUNT, sizeof(pal_sprite));
+
     uint8_t off = TILE_NUM_START;
     for (uint8_t i = 0; i < SPRITE_COUNT; i++) {
-        START_ROM_BANK(metasprites[i].bank) {
-            if (metasprites[i].off == TILE_NUM_START) {
-                metasprites[i].off = off;
-                off += metasprites[i].cnt;
-                set_sprite_data(metasprites[i].off, metasprites[i].cnt, metasprites[i].ti);
-            } else {
-                metasprites[i].off = metasprites[metasprites[i].off].off;
-            }
-        } END_ROM_BANK
+        if (metasprites[i].off == TILE_NUM_START) {
+            metasprites[i].off = off;
+            off += metasprites[i].cnt;
+            lz_begin(metasprites[i].ti, metasprites[i].bank);
+            lz_sprite_data(metasprites[i].off, metasprites[i].cnt);
+        } else {
+            metasprites[i].off = metasprites[metasprites[i].off].off;
+        }
     }
+
+    lz_report();
 }
 
 void spr_init_pal(void) NONBANKED {
@@ -43,6 +129,8 @@ void spr_init_pal(void) NONBANKED {
         return;
     }
 
+    memset(pal_sprite, SPRITE_COUNT, sizeof(pal_sprite));
+
     for (uint8_t i = 0; i < SPRITE_COUNT; i++) {
         uint8_t bank = metasprites[i].bank;
         if (metasprites[i].pa == power_palettes) {
@@ -57,13 +145,24 @@ void spr_init_pal(void) NONBANKED {
     }
 }
 
-void spr_draw(enum SPRITES sprite, enum SPRITE_FLIP flip,
-              int8_t x_off, int8_t y_off, uint8_t frame,
-              uint8_t *hiwater) NONBANKED {
-    if (sprite >= SPRITE_COUNT) {
+// called with the bank of the sprite mapped
+static void spr_palette(uint8_t slot, enum SPRITES sprite, uint8_t pa_i) NONBANKED {
+    if ((pal_sprite[slot] == sprite) && (pal_index[slot] == pa_i)) {
         return;
     }
 
+    // only remembered when queued, otherwise tried again next time
+    if (vram_spr_palette(slot, metasprites[sprite].pa + (pa_i * 4))) {
+        pal_sprite[slot] = sprite;
+        pal_index[slot] = pa_i;
+    }
+}
+
+static uint8_t spr_emit(enum SPRITES sprite, enum SPRITE_FLIP flip,
+                        int8_t x_off, int8_t y_off, uint8_t frame,
+                        uint8_t base) NONBANKED {
+    uint8_t n = 0;
+
     START_ROM_BANK(metasprites[sprite].bank) {
         if (frame >= metasprites[sprite].ms_n) {
             frame = 0;
@@ -78,125 +177,283 @@ void spr_draw(enum SPRITES sprite, enum SPRITE_FLIP flip,
                     pa_i = 0;
                 }
 
-                set_sprite_palette((metasprites[sprite].pa_i & PALETTE_NO_FLAGS) + pa_i, 1, metasprites[sprite].pa + (pa_i * 4));
+                spr_palette((metasprites[sprite].pa_i & PALETTE_NO_FLAGS) + pa_i, sprite, pa_i);
             } else if ((metasprites[sprite].pa_i & PALETTE_ALL_FLAGS) == PALETTE_DYNAMIC_LOAD_IP) {
                 pa_off = frame;
                 if (pa_off >= metasprites[sprite].pa_n) {
                     pa_off = 0;
                 }
 
-                set_sprite_palette((metasprites[sprite].pa_i & PALETTE_NO_FLAGS), 1, metasprites[sprite].pa + (pa_off * 4));
+                spr_palette((metasprites[sprite].pa_i & PALETTE_NO_FLAGS), sprite, pa_off);
             }
         }
 
         switch (flip) {
             case FLIP_Y:
-                *hiwater += move_metasprite_flipy(
+                n = move_metasprite_flipy(
                         metasprites[sprite].ms[frame], metasprites[sprite].off,
-                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, *hiwater,
+                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, base,
                         DEVICE_SPRITE_PX_OFFSET_X + (DEVICE_SCREEN_PX_WIDTH / 2) + x_off,
                         DEVICE_SPRITE_PX_OFFSET_Y + (DEVICE_SCREEN_PX_HEIGHT / 2) + y_off);
                 break;
 
             case FLIP_XY:
-                *hiwater += move_metasprite_flipxy(
+                n = move_metasprite_flipxy(
                         metasprites[sprite].ms[frame], metasprites[sprite].off,
-                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, *hiwater,
+                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, base,
                         DEVICE_SPRITE_PX_OFFSET_X + (DEVICE_SCREEN_PX_WIDTH / 2) + x_off,
                         DEVICE_SPRITE_PX_OFFSET_Y + (DEVICE_SCREEN_PX_HEIGHT / 2) + y_off);
                 break;
 
             case FLIP_X:
-                *hiwater += move_metasprite_flipx(
+                n = move_metasprite_flipx(
                         metasprites[sprite].ms[frame], metasprites[sprite].off,
-                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, *hiwater,
+                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, base,
                         DEVICE_SPRITE_PX_OFFSET_X + (DEVICE_SCREEN_PX_WIDTH / 2) + x_off,
                         DEVICE_SPRITE_PX_OFFSET_Y + (DEVICE_SCREEN_PX_HEIGHT / 2) + y_off);
                 break;
 
             case FLIP_NONE:
             default:
-                *hiwater += move_metasprite_ex(
+                n = move_metasprite_ex(
                         metasprites[sprite].ms[frame], metasprites[sprite].off,
-                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, *hiwater,
+                        (metasprites[sprite].pa_i - pa_off) & PALETTE_NO_FLAGS, base,
                         DEVICE_SPRITE_PX_OFFSET_X + (DEVICE_SCREEN_PX_WIDTH / 2) + x_off,
                         DEVICE_SPRITE_PX_OFFSET_Y + (DEVICE_SCREEN_PX_HEIGHT / 2) + y_off);
                 break;
         }
     } END_ROM_BANK
+
+    return n;
+}
+
+/*
+ * Checks if a queued metasprite still fits into the OAM and
+ * below the per-scanline limit, and reserves its space if so.
+ * Pinned sprites are only limited by the OAM size.
+ * Scanlines are grouped into bands of 8 lines, so this is
+ * a bit more conservative than the hardware.
+ */
+static uint8_t spr_fit(const struct spr_req *r, uint8_t oam_free, uint8_t pinned) NONBANKED {
+    uint8_t need[SPR_BANDS];
+    uint8_t tiles = 0;
+    uint8_t fits = 1;
+
+    memset(need, 0, sizeof(need));
+
+    START_ROM_BANK(metasprites[r->sprite].bank) {
+        uint8_t frame = r->frame;
+        if (frame >= metasprites[r->sprite].ms_n) {
+            frame = 0;
+        }
+
+        int16_t y = (DEVICE_SCREEN_PX_HEIGHT / 2) + r->y_off;
+        int16_t cum = 0;
+
+        for (const metasprite_t *ms = metasprites[r->sprite].ms[frame]; ms->dy != (int8_t)metasprite_end; ms++) {
+            tiles++;
+            cum += ms->dy;
+
+            // same as the flipped placement in move_metasprite_flipy
+            int16_t line = (r->flip & FLIP_Y) ? (y - 8 - cum) : (y + cum);
+            if ((line <= -8) || (line >= DEVICE_SCREEN_PX_HEIGHT)) {
+                continue;
+            }
+
+            uint8_t first = (line < 0) ? 0 : (line >> 3);
+            uint8_t last = (line + 7) >> 3;
+            if (last >= SPR_BANDS) {
+                last = SPR_BANDS - 1;
+            }
+            for (uint8_t b = first; b <= last; b++) {
+                need[b]++;
+            }
+        }
+    } END_ROM_BANK
+
+    if (tiles > oam_free) {
+        return 0;
+    }
+
+    if (!pinned) {
+        for (uint8_t b = 0; b < SPR_BANDS; b++) {
+            if ((band_cnt[b] + need[b]) > SPR_LINE_MAX) {
+                fits = 0;
+                break;
+            }
+        }
+    }
+
+    if (fits) {
+        for (uint8_t b = 0; b < SPR_BANDS; b++) {
+            band_cnt[b] += need[b];
+        }
+    }
+
+    return fits;
+}
+
+void spr_sched_begin(void) NONBANKED {
+    sched_on = 1;
+    queue_len = 0;
+    queue_over = 0;
+    memset(prio_len, 0, sizeof(prio_len));
+}
+
+void spr_sched_end(uint8_t *hiwater) NONBANKED {
+    uint8_t dropped = queue_over;
+
+    sched_on = 0;
+    memset(band_cnt, 0, sizeof(band_cnt));
+
+    for (uint8_t p = 0; p < PRIO_COUNT; p++) {
+        uint8_t n = prio_len[p];
+        if (n == 0) {
+            continue;
+        }
+
+        // start at a different request each frame, so overflowing ones take turns
+        uint8_t j = (p == PRIO_PINNED) ? 0 : (sched_rot % n);
+
+        for (uint8_t k = 0; k < n; k++) {
+            const struct spr_req *r = &queue[prio_list[p][j]];
+
+            if (spr_fit(r, MAX_HARDWARE_SPRITES - *hiwater, p == PRIO_PINNED)) {
+                *hiwater += spr_emit(r->sprite, r->flip, r->x_off, r->y_off, r->frame, *hiwater);
+            } else {
+                dropped++;
+            }
+
+            if (++j >= n) {
+                j = 0;
+            }
+        }
+    }
+
+    // keep a stable order as long as everything fits
+    if (dropped > 0) {
+        sched_rot++;
+    }
+}
+
+void spr_oam_begin(void) NONBANKED {
+    // always render into the buffer the DMA is not reading from
+    if (_shadow_OAM_base == OAM_PAGE(shadow_OAM)) {
+        __render_shadow_OAM = OAM_PAGE(shadow_OAM2);
+    } else {
+        __render_shadow_OAM = OAM_PAGE(shadow_OAM);
+    }
+}
+
+void spr_oam_commit(void) NONBANKED {
+    // single byte write, so the VBlank DMA sees either the old or the new page
+    SET_SHADOW_OAM_ADDRESS((uint16_t)__render_shadow_OAM << 8);
+}
+
+void spr_oam_reset(void) NONBANKED {
+    __render_shadow_OAM = OAM_PAGE(shadow_OAM);
+    SET_SHADOW_OAM_ADDRESS(shadow_OAM);
+}
+
+void spr_draw(enum SPRITES sprite, enum SPRITE_FLIP flip,
+              int8_t x_off, int8_t y_off, uint8_t frame,
+              uint8_t *hiwater) NONBANKED {
+    if (sprite >= SPRITE_COUNT) {
+        return;
+    }
+
+    if (!sched_on) {
+        *hiwater += spr_emit(sprite, flip, x_off, y_off, frame, *hiwater);
+        return;
+    }
+
+    if (queue_len >= SPR_QUEUE_LEN) {
+        // counts as dropped, so the priority classes still rotate
+        queue_over++;
+        return;
+    }
+
+    queue[queue_len].sprite = sprite;
+    queue[queue_len].flip = flip;
+    queue[queue_len].x_off = x_off;
+    queue[queue_len].y_off = y_off;
+    queue[queue_len].frame = frame;
+
+    uint8_t p = spr_prio[sprite];
+    prio_list[p][prio_len[p]++] = queue_len++;
 }
 
-void spr_ship(enum SPRITE_ROT rot, uint8_t moving, uint8_t *hiwater) NONBANKED {
+void spr_ship(enum SPRITE_ROT rot, uint8_t moving, int8_t x_off, int8_t y_off, uint8_t *hiwater) NONBANKED {
     switch (rot) {
         case ROT_0:
-            spr_draw(SPR_SHIP, FLIP_NONE, -1, 4, moving ? 1 : 0, hiwater);
+            spr_draw(SPR_SHIP, FLIP_NONE, x_off - 1, y_off + 4, moving ? 1 : 0, hiwater);
             break;
 
         case ROT_22_5:
-            spr_draw(SPR_SHIP, FLIP_NONE, -4, 2, moving ? 7 : 6, hiwater);
+            spr_draw(SPR_SHIP, FLIP_NONE, x_off - 4, y_off + 2, moving ? 7 : 6, hiwater);
             break;
 
         case ROT_45:
-            spr_draw(SPR_SHIP, FLIP_NONE, 1, -1, moving ? 3 : 2, hiwater);
+            spr_draw(SPR_SHIP, FLIP_NONE, x_off + 1, y_off - 1, moving ? 3 : 2, hiwater);
             break;
 
         case ROT_67_5:
-            spr_draw(SPR_SHIP, FLIP_NONE, -2, -4, moving ? 9 : 8, hiwater);
+            spr_draw(SPR_SHIP, FLIP_NONE, x_off - 2, y_off - 4, moving ? 9 : 8, hiwater);
             break;
 
         // ------------------------------
 
         case ROT_90:
-            spr_draw(SPR_SHIP, FLIP_NONE, -4, -1, moving ? 5 : 4, hiwater);
+            spr_draw(SPR_SHIP, FLIP_NONE, x_off - 4, y_off - 1, moving ? 5 : 4, hiwater);
             break;
 
         case ROT_112_5:
-            spr_draw(SPR_SHIP, FLIP_Y, -2, 4, moving ? 9 : 8, hiwater);
+            spr_draw(SPR_SHIP, FLIP_Y, x_off - 2, y_off + 4, moving ? 9 : 8, hiwater);
             break;
 
         case ROT_135:
-            spr_draw(SPR_SHIP, FLIP_Y, 1, 1, moving ? 3 : 2, hiwater);
+            spr_draw(SPR_SHIP, FLIP_Y, x_off + 1, y_off + 1, moving ? 3 : 2, hiwater);
             break;
 
         case ROT_157_5:
-            spr_draw(SPR_SHIP, FLIP_Y, -2, -2, moving ? 7 : 6, hiwater);
+            spr_draw(SPR_SHIP, FLIP_Y, x_off - 2, y_off - 2, moving ? 7 : 6, hiwater);
             break;
 
         // ------------------------------
         // ------------------------------
 
         case ROT_180:
-            spr_draw(SPR_SHIP, FLIP_Y, 0, -4, moving ? 1 : 0, hiwater);
+            spr_draw(SPR_SHIP, FLIP_Y, x_off, y_off - 4, moving ? 1 : 0, hiwater);
             break;
 
         case ROT_202_5:
-            spr_draw(SPR_SHIP, FLIP_XY, 3, -2, moving ? 7 : 6, hiwater);
+            spr_draw(SPR_SHIP, FLIP_XY, x_off + 3, y_off - 2, moving ? 7 : 6, hiwater);
             break;
 
         case ROT_225:
-            spr_draw(SPR_SHIP, FLIP_XY, -1, 1, moving ? 3 : 2, hiwater);
+            spr_draw(SPR_SHIP, FLIP_XY, x_off - 1, y_off + 1, moving ? 3 : 2, hiwater);
             break;
 
         case ROT_247_5:
-            spr_draw(SPR_SHIP, FLIP_XY, 2, 4, moving ? 9 : 8, hiwater);
+            spr_draw(SPR_SHIP, FLIP_XY, x_off + 2, y_off + 4, moving ? 9 : 8, hiwater);
             break;
 
         // ------------------------------
 
         case ROT_270:
-            spr_draw(SPR_SHIP, FLIP_X, 4, 0, moving ? 5 : 4, hiwater);
+            spr_draw(SPR_SHIP, FLIP_X, x_off + 4, y_off, moving ? 5 : 4, hiwater);
             break;
 
         case ROT_292_5:
-            spr_draw(SPR_SHIP, FLIP_X, 2, -4, moving ? 9 : 8, hiwater);
+            spr_draw(SPR_SHIP, FLIP_X, x_off + 2, y_off - 4, moving ? 9 : 8, hiwater);
             break;
 
         case ROT_315:
-            spr_draw(SPR_SHIP, FLIP_X, -1, -1, moving ? 3 : 2, hiwater);
+            spr_draw(SPR_SHIP, FLIP_X, x_off - 1, y_off - 1, moving ? 3 : 2, hiwater);
             break;
 
         case ROT_337_5:
-            spr_draw(SPR_SHIP, FLIP_X, 2, 2, moving ? 7 : 6, hiwater);
+            spr_draw(SPR_SHIP, FLIP_X, x_off + 2, y_off + 2, moving ? 7 : 6, hiwater);
             break;
 
         default:
@@ -73,6 +73,26 @@ enum SPRITE_ROT {
 void spr_init(void);
 void spr_init_pal(void);
 void spr_draw(enum SPRITES sprite, enum SPRITE_FLIP flip, int8_t x_off, int8_t y_off, uint8_t frame, uint8_t *hiwater);
-void spr_ship(enum SPRITE_ROT rot, uint8_t moving, uint8_t *hiwater);
+
+/*
+ * Most requests game() queues per frame besides the objects:
+ * four health and four power bars, the ship, two debug markers,
+ * and the other ship with its shots in versus mode.
+ */
+#define SPR_GAME_EXTRA (4 + 4 + 1 + 2 + 1 + 4)
+
+// between these, spr_draw only queues and doesn't touch hiwater
+void spr_sched_begin(void);
+void spr_sched_end(uint8_t *hiwater);
+
+/*
+ * Double buffered shadow OAM. A frame drawn between begin and
+ * commit is only shown completely, or not at all when it took
+ * too long. Reset goes back to the single buffer for menus.
+ */
+void spr_oam_begin(void);
+void spr_oam_commit(void);
+void spr_oam_reset(void);
+void spr_ship(enum SPRITE_ROT rot, uint8_t moving, int8_t x_off, int8_t y_off, uint8_t *hiwater);
 
 #endif // __SPRITES_H__
@@ -53,7 +53,8 @@ static const char   string_printf_error[] = "error: 0x%x";
 static const char  string_printf_frames[] = "Frames: 0x%x";
 static const char   string_printf_timer[] = " Timer: 0x%x";
 static const char   string_printf_stack[] = " Stack: 0x%x";
-static const char     string_printf_fps[] = "   FPS: %hd";
+static const char     string_printf_fps[] = "   FPS: %hd (%u)";
+static const char    string_printf_prof[] = "  Load: %hd ";
 static const char        string_spinner[] = "/-\\|";
 static const char        string_game_in[] = "Game in";
 static const char       string_progress[] = "Progress";
@@ -91,6 +92,7 @@ static const char * const strings[COUNT_STRINGS] = {
     string_printf_timer,   // STR_PRINTF_TIMER
     string_printf_stack,   // STR_PRINTF_STACK
     string_printf_fps,     // STR_PRINTF_FPS
+    string_printf_prof,    // STR_PRINTF_PROF
     string_spinner,        // STR_SPINNER
     string_game_in,        // STR_GAME_IN
     string_progress,       // STR_PROGRESS
@@ -53,6 +53,7 @@ enum STRINGS {
     STR_PRINTF_TIMER,
     STR_PRINTF_STACK,
     STR_PRINTF_FPS,
+    STR_PRINTF_PROF,
     STR_SPINNER,
     STR_GAME_IN,
     STR_PROGRESS,
@@ -20,12 +20,14 @@
 #include <gbdk/platform.h>
 #include <string.h>
 #include <stdio.h>
+#include <assert.h>
 
 #include "banks.h"
 #include "maps.h"
 #include "map_data.h"
 #include "window.h"
 #include "text.h"
+#include "vram.h"
 
 // TODO inverted score color not visible on DMG
 // TODO selected menu entry not visible on DMG
@@ -163,29 +165,149 @@ static void digit(uint8_t val, uint8_t pos, uint8_t x_off, uint8_t y_off, uint8_
                        maps[FNT_NUM_16].bank, is_black ? TEXT_ATTR_BLACK : TEXT_ATTR_WHITE);
 }
 
-uint8_t number(int32_t score, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED {
-    // TODO can not set numbers larger than int16 max?!
-    //score = 32767 + 1; // wtf?!
+// digits are least significant first
+static uint8_t number_draw(const uint8_t *digits, uint8_t len, uint8_t x_off, uint8_t y_off, uint8_t is_black) {
+    uint8_t off = (x_off == 0xFF) ? (TEXT_LINE_WIDTH - len)
+               : ((x_off == 0xFE) ? ((TEXT_LINE_WIDTH * 2) - (len * 2)) : x_off);
+    for (uint8_t i = 0; i < len; i++) {
+        digit(digits[len - i - 1], i, off, y_off, is_black);
+    }
+
+    return 8 * len * 2;
+}
+
+// digits that did not fit into the VRAM queue last time
+uint8_t number_cached_pending(void) BANKED {
+    return cache_pending;
+}
+
+// the nibbles already are the digits, zero when too long
+static uint8_t number_digits(const struct bcd *score, uint8_t *digits) {
+    uint8_t len = bcd_len(score);
+    if (len > MAX_DIGITS) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < len; i++) {
+        digits[i] = bcd_digit(score, i);
+    }
+    return len;
+}
 
+uint8_t number(uint16_t value, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED {
     uint8_t len = 0;
     uint8_t digits[MAX_DIGITS];
     do {
-        digits[len++] = score % 10L;
-        score = score / 10L;
-        if (len >= MAX_DIGITS) {
-            break;
-        }
-    } while (score > 0);
+        digits[len++] = value % 10;
+        value = value / 10;
+    } while (value > 0);
+
+    return number_draw(digits, len, x_off, y_off, is_black);
+}
+
+uint8_t number_score(const struct bcd *score, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED {
+    uint8_t digits[MAX_DIGITS];
+    uint8_t len = number_digits(score, digits);
 
     // if the number was too large for our buffer don't draw anything
-    if (score > 0) {
+    if (len == 0) {
         return 0;
     }
 
-    uint8_t off = (x_off == 0xFF) ? (TEXT_LINE_WIDTH - len)
-               : ((x_off == 0xFE) ? ((TEXT_LINE_WIDTH * 2) - (len * 2)) : x_off);
-    for (uint8_t i = 0; i < len; i++) {
-        digit(digits[len - i - 1], i, off, y_off, is_black);
+    return number_draw(digits, len, x_off, y_off, is_black);
+}
+
+// ----------------------------------------------------------------------------
+// Cached numbers 16x16 (for the in-game score)
+// ----------------------------------------------------------------------------
+
+/*
+ * Remembers the digits already in the window and only queues
+ * the changed ones. The tiles are resolved when queueing, so
+ * the VBlank handler only has to copy them into VRAM.
+ */
+
+#define DIGIT_W 2 // tiles per row of a FNT_NUM_16 character
+#define DIGIT_BLANK 0xFF
+#define DIGIT_INVALID 0xFE
+#define DIGIT_BLANK_TILE 0xFF
+#define DIGIT_BLANK_ATTR BKGF_CGB_PAL3
+
+static_assert((DIGIT_W * 2) <= VRAM_DATA_LEN, "digit does not fit one command");
+
+static uint8_t cache_x = 0, cache_y = 0;
+static uint8_t cache_black = 0;
+static uint8_t cache_digits[MAX_DIGITS];
+static uint8_t cache_pending = 0;
+
+static void number_queue(uint8_t val, uint8_t pos, uint8_t is_black, uint8_t attr) NONBANKED {
+    uint8_t t[DIGIT_W * 2];
+    uint8_t x = cache_x + (pos * DIGIT_W);
+
+    if (val == DIGIT_BLANK) {
+        memset(t, DIGIT_BLANK_TILE, DIGIT_W * 2);
+    } else {
+        const uint8_t *map = maps[FNT_NUM_16].map + (val * DIGIT_W);
+        uint8_t base = maps[FNT_NUM_16].tile_offset;
+
+        START_ROM_BANK(maps[FNT_NUM_16].bank) {
+            for (uint8_t i = 0; i < DIGIT_W; i++) {
+                t[i] = map[i] + base;
+                t[DIGIT_W + i] = map[(maps[FNT_NUM_16].map_count / 2) + i] + base;
+            }
+        } END_ROM_BANK
+    }
+
+    if (attr) {
+        vram_win_attr(x, cache_y, DIGIT_W, 2, (val == DIGIT_BLANK) ? DIGIT_BLANK_ATTR
+                      : (is_black ? TEXT_ATTR_BLACK : TEXT_ATTR_WHITE));
+    }
+    vram_win_tiles(x, cache_y, DIGIT_W, 2, t);
+}
+
+void number_cached_reset(uint8_t x_off, uint8_t y_off) BANKED {
+    cache_x = x_off;
+    cache_y = y_off;
+    memset(cache_digits, DIGIT_BLANK, MAX_DIGITS);
+    cache_pending = 0;
+}
+
+uint8_t number_width(const struct bcd *score) BANKED {
+    uint8_t digits[MAX_DIGITS];
+    return 8 * number_digits(score, digits) * 2;
+}
+
+uint8_t number_cached(const struct bcd *score, uint8_t is_black) BANKED {
+    uint8_t digits[MAX_DIGITS];
+    uint8_t len = number_digits(score, digits);
+    cache_pending = 0;
+    if (len == 0) {
+        return 0;
+    }
+
+    // a new color needs all digits, but blanks stay as they are
+    uint8_t recolor = (is_black != cache_black);
+    cache_black = is_black;
+
+    for (uint8_t i = 0; i < MAX_DIGITS; i++) {
+        uint8_t d = (i < len) ? digits[len - i - 1] : DIGIT_BLANK;
+        uint8_t old = cache_digits[i];
+        if ((d == old) && !(recolor && (i < len))) {
+            continue;
+        }
+
+        // the attributes only change with the color or from and to blank
+        uint8_t attr = recolor || (d == DIGIT_BLANK) || (old >= DIGIT_INVALID);
+
+        // queue full, try this digit again next frame
+        if (vram_space() < (attr ? 2 : 1)) {
+            cache_digits[i] = DIGIT_INVALID;
+            cache_pending = 1;
+            continue;
+        }
+
+        cache_digits[i] = d;
+        number_queue(d, i, is_black, attr);
     }
 
     return 8 * len * 2;
@@ -22,6 +22,8 @@
 
 #include <gbdk/platform.h>
 
+#include "bcd.h"
+
 #define MAX_DIGITS 7
 #define TEXT_LINE_WIDTH 10
 
@@ -40,7 +42,17 @@ void str_lines(const char *s, uint8_t y_off, uint8_t is_black) BANKED;
 // Numbers 16x16 (for scores)
 // ----------------------------------------------------------------------------
 
-uint8_t number(int32_t score, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED;
+uint8_t number(uint16_t value, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED;
+uint8_t number_score(const struct bcd *score, uint8_t x_off, uint8_t y_off, uint8_t is_black) BANKED; // magnitude only
+
+// ----------------------------------------------------------------------------
+// Cached numbers 16x16 (for the in-game score, queued for VBlank)
+// ----------------------------------------------------------------------------
+
+void number_cached_reset(uint8_t x_off, uint8_t y_off) BANKED;
+uint8_t number_width(const struct bcd *score) BANKED;
+uint8_t number_cached(const struct bcd *score, uint8_t is_black) BANKED;
+uint8_t number_cached_pending(void) BANKED;
 
 // ----------------------------------------------------------------------------
 // GBC-only ASCII 8x8 font (for detailed / debug output)
@@ -21,13 +21,26 @@
 #include "sound.h"
 #include "timer.h"
 
-#define DMG_TMA_VAL (0x100UL -  64UL) // 16.384kHz /  64 = 256Hz
-#define CGB_TMA_VAL (0x100UL - 128UL) // 32.768kHz / 128 = 256Hz
+#define DMG_TMA_VAL (0x100UL - (16384UL / SAMPLE_TICK_HZ)) // 16.384kHz /  64 = 256Hz by default
+#define CGB_TMA_VAL (0x100UL - (32768UL / SAMPLE_TICK_HZ)) // 32.768kHz / 128 = 256Hz by default
 
 static uint16_t count = 0;
 
+#if SAMPLE_TICK_HZ > 256
+static uint8_t sub = 0;
+#endif
+
 static void timer_isr(void) NONBANKED {
     sample_isr();
+
+#if SAMPLE_TICK_HZ > 256
+    // music and timer_get() stay at 256Hz
+    if (++sub < (SAMPLE_TICK_HZ / 256)) {
+        return;
+    }
+    sub = 0;
+#endif
+
     snd_play();
     count++;
 }
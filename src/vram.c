@@ -0,0 +1,212 @@
+/*
+ * vram.c
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "vram.h"
+
+#define VRAM_QUEUE_LEN 32 // one slot stays empty, to tell full from empty
+
+// rough cost of the writes, in bytes, handled per VBlank
+#define VRAM_VBL_BUDGET 48
+#define VRAM_CMD_COST 4
+
+enum VRAM_CMD {
+    VRAM_BKG_TILES = 0,
+    VRAM_BKG_ATTRS,
+    VRAM_WIN_TILES,
+    VRAM_WIN_FILL,
+    VRAM_WIN_ATTR,
+    VRAM_SPR_PALETTE,
+    VRAM_MOVE_WIN,
+};
+
+struct vram_cmd {
+    enum VRAM_CMD type;
+    uint8_t x, y, w, h;
+    uint8_t data[VRAM_DATA_LEN];
+};
+
+BANKREF(vram)
+
+// head is only moved by the handler, tail only by the main loop
+static struct vram_cmd queue[VRAM_QUEUE_LEN];
+static volatile uint8_t head = 0;
+static volatile uint8_t tail = 0;
+
+static uint8_t vram_run(uint16_t budget) NONBANKED {
+    // the main loop may be in the middle of its own VRAM writes
+    uint8_t vbk = VBK_REG;
+
+    while (head != tail) {
+        struct vram_cmd *c = &queue[head];
+        uint16_t cost = VRAM_CMD_COST;
+
+        switch (c->type) {
+            case VRAM_BKG_TILES:
+                VBK_REG = VBK_TILES;
+                set_bkg_tiles(c->x, c->y, c->w, c->h, c->data);
+                cost += c->w * c->h;
+                break;
+
+            case VRAM_BKG_ATTRS:
+                if (_cpu == CGB_TYPE) {
+                    VBK_REG = VBK_ATTRIBUTES;
+                    set_bkg_tiles(c->x, c->y, c->w, c->h, c->data);
+                    cost += c->w * c->h;
+                }
+                break;
+
+            case VRAM_WIN_TILES:
+                VBK_REG = VBK_TILES;
+                set_win_tiles(c->x, c->y, c->w, c->h, c->data);
+                cost += c->w * c->h;
+                break;
+
+            case VRAM_WIN_FILL:
+                VBK_REG = VBK_TILES;
+                fill_win_rect(c->x, c->y, c->w, c->h, c->data[0]);
+                cost += c->w * c->h;
+                break;
+
+            case VRAM_WIN_ATTR:
+                if (_cpu == CGB_TYPE) {
+                    VBK_REG = VBK_ATTRIBUTES;
+                    fill_win_rect(c->x, c->y, c->w, c->h, c->data[0]);
+                    cost += c->w * c->h;
+                }
+                break;
+
+            case VRAM_SPR_PALETTE:
+                if (_cpu == CGB_TYPE) {
+                    set_sprite_palette(c->x, 1, (const palette_color_t *)c->data);
+                    cost += VRAM_DATA_LEN;
+                }
+                break;
+
+            case VRAM_MOVE_WIN:
+                move_win(c->x, c->y);
+                break;
+        }
+
+        head = (head + 1) & (VRAM_QUEUE_LEN - 1);
+
+        // always at least one command, so big ones can not get stuck
+        if (cost >= budget) {
+            break;
+        }
+        budget -= cost;
+    }
+
+    VBK_REG = vbk;
+    return head != tail;
+}
+
+static void vram_vbl(void) NONBANKED {
+    vram_run(VRAM_VBL_BUDGET);
+}
+
+void vram_init(void) BANKED {
+    CRITICAL {
+        head = 0;
+        tail = 0;
+        add_VBL(vram_vbl);
+    }
+}
+
+void vram_flush(void) NONBANKED {
+    CRITICAL {
+        while (vram_run(0xFFFF));
+    }
+}
+
+uint8_t vram_space(void) NONBANKED {
+    return (head - tail - 1) & (VRAM_QUEUE_LEN - 1);
+}
+
+static struct vram_cmd *vram_next(void) NONBANKED {
+    if (((tail + 1) & (VRAM_QUEUE_LEN - 1)) == head) {
+        return NULL;
+    }
+    return &queue[tail];
+}
+
+static uint8_t vram_push(enum VRAM_CMD type, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t v) NONBANKED {
+    struct vram_cmd *c = vram_next();
+    if (c == NULL) {
+        return 0;
+    }
+
+    c->type = type;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->data[0] = v;
+
+    // publish only when complete
+    tail = (tail + 1) & (VRAM_QUEUE_LEN - 1);
+    return 1;
+}
+
+static uint8_t vram_copy(enum VRAM_CMD type, uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                         const void *data, uint16_t len) NONBANKED {
+    struct vram_cmd *c = vram_next();
+    if ((c == NULL) || (len > VRAM_DATA_LEN)) {
+        return 0;
+    }
+
+    c->type = type;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    memcpy(c->data, data, len);
+
+    tail = (tail + 1) & (VRAM_QUEUE_LEN - 1);
+    return 1;
+}
+
+uint8_t vram_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles) NONBANKED {
+    return vram_copy(VRAM_BKG_TILES, x, y, w, h, tiles, w * h);
+}
+
+uint8_t vram_bkg_attrs(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *attrs) NONBANKED {
+    return vram_copy(VRAM_BKG_ATTRS, x, y, w, h, attrs, w * h);
+}
+
+uint8_t vram_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles) NONBANKED {
+    return vram_copy(VRAM_WIN_TILES, x, y, w, h, tiles, w * h);
+}
+
+uint8_t vram_win_fill(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile) NONBANKED {
+    return vram_push(VRAM_WIN_FILL, x, y, w, h, tile);
+}
+
+uint8_t vram_win_attr(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t attr) NONBANKED {
+    return vram_push(VRAM_WIN_ATTR, x, y, w, h, attr);
+}
+
+uint8_t vram_spr_palette(uint8_t pal, const palette_color_t *colors) NONBANKED {
+    return vram_copy(VRAM_SPR_PALETTE, pal, 0, 0, 0, colors, VRAM_DATA_LEN);
+}
+
+uint8_t vram_move_win(uint8_t x, uint8_t y) NONBANKED {
+    return vram_push(VRAM_MOVE_WIN, x, y, 0, 0, 0);
+}
@@ -0,0 +1,53 @@
+/*
+ * vram.h
+ * Duality
+ *
+ * Copyright (C) 2025 Thomas Buck <thomas@xythobuz.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * See <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __VRAM_H__
+#define __VRAM_H__
+
+#include <gbdk/platform.h>
+#include <stdint.h>
+
+/*
+ * Queue for VRAM, palette and window register writes during
+ * gameplay. Commands are copied when appended and the VBlank
+ * handler works through them in order, as many as fit into
+ * its budget. The rest waits for the next VBlank.
+ *
+ * Appending never blocks. It returns zero when the queue is
+ * full, so the caller can try again in the next frame.
+ * Code writing VRAM directly has to call vram_flush() first.
+ */
+
+#define VRAM_DATA_LEN 8 // tiles or bytes of palette per command
+
+void vram_init(void) BANKED;
+void vram_flush(void);
+uint8_t vram_space(void);
+
+uint8_t vram_bkg_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles);
+uint8_t vram_bkg_attrs(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *attrs);
+uint8_t vram_win_tiles(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *tiles);
+uint8_t vram_win_fill(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile);
+uint8_t vram_win_attr(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t attr);
+uint8_t vram_spr_palette(uint8_t pal, const palette_color_t *colors);
+uint8_t vram_move_win(uint8_t x, uint8_t y);
+
+BANKREF_EXTERN(vram)
+
+#endif // __VRAM_H__
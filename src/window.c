@@ -34,9 +34,13 @@
 #include "multiplayer.h"
 #include "strings.h"
 #include "timer.h"
+#include "profile.h"
 #include "game.h"
+#include "vram.h"
 #include "window.h"
 
+#define PROF_BAR_LEN 8
+
 BANKREF(window)
 
 static char str_buff[128];
@@ -48,6 +52,15 @@ static void get_sp(void) {
     __endasm;
 }
 
+// one character per 1/8th of the scanlines in a frame
+static void prof_bar(char *s, uint8_t load) {
+    uint8_t fill = ((uint16_t)load * PROF_BAR_LEN) / PROF_FRAME_LINES;
+    for (uint8_t i = 0; i < PROF_BAR_LEN; i++) {
+        *(s++) = (i < fill) ? '#' : '.';
+    }
+    *s = '\0';
+}
+
 void fill_win(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile, uint8_t attr) BANKED {
     if (_cpu == CGB_TYPE) {
         VBK_REG = VBK_ATTRIBUTES;
@@ -58,13 +71,16 @@ void fill_win(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile, uint8_t
     fill_win_rect(x, y, w, h, tile);
 }
 
-void win_splash_draw(int32_t lowest, int32_t highest) BANKED {
+void win_splash_draw(const struct bcd *lowest, const struct bcd *highest) BANKED {
     map_fill(MAP_TITLE, 0);
 
+    struct bcd low = *lowest;
+    bcd_neg(&low);
+
     // only show on splash if they fit
-    if ((lowest <= 99999) && (highest <= 99999)) {
-        number(lowest, 0, DEVICE_SCREEN_HEIGHT - 4, 1);
-        number(highest, 0xFE, DEVICE_SCREEN_HEIGHT - 4, 0);
+    if ((bcd_len(&low) <= 5) && (bcd_len(highest) <= 5)) {
+        number_score(&low, 0, DEVICE_SCREEN_HEIGHT - 4, 1);
+        number_score(highest, 0xFE, DEVICE_SCREEN_HEIGHT - 4, 0);
 
         str(get_string(STR_TOP), 0, DEVICE_SCREEN_HEIGHT - 2, 1);
         str(get_string(STR_SCORE), 10, DEVICE_SCREEN_HEIGHT - 2, 0);
@@ -94,7 +110,10 @@ void win_score_clear(uint8_t is_black, uint8_t no_bg) BANKED {
 
 void win_score_draw(struct scores score, uint8_t off, uint8_t is_black) BANKED {
     str3(score.name, 0, 4 + off * 3, is_black, is_black, is_black);
-    number(is_black ? -score.score : score.score, 7, 4 + off * 3, is_black);
+    if (is_black) {
+        bcd_neg(&score.score);
+    }
+    number_score(&score.score, 7, 4 + off * 3, is_black);
 }
 
 void win_score_print(enum PRN_STATUS status) BANKED {
@@ -179,7 +198,9 @@ static uint8_t get_debug(char *name_buff, uint8_t i) NONBANKED {
 
         n_len = strlen(name_buff);
         name_buff[n_len] = ' ';
-        if (debug_entries[i].flag == DBG_NONE) {
+        if (i == DEBUG_MENU_TIER_INDEX) {
+            name_buff[n_len + 1] = obj_get_tier() + '0';
+        } else if (debug_entries[i].flag == DBG_NONE) {
             if (debug_menu_index == i) {
                 name_buff[n_len + 1] = debug_special_value + '0';
             } else {
@@ -254,16 +275,23 @@ void win_conf(void) BANKED {
     }
 }
 
-void win_name(int32_t score) BANKED {
+void win_name(const struct bcd *score) BANKED {
     map_fill(MAP_TITLE, 0);
 
-    str_center(get_string(STR_SCORE), 1, score < 0);
-    number(score < 0 ? -score : score, 0xFF, 3, score < 0);
+    struct bcd v = *score;
+    uint8_t is_black = 0;
+    if (bcd_sign(&v) < 0) {
+        bcd_neg(&v);
+        is_black = 1;
+    }
+
+    str_center(get_string(STR_SCORE), 1, is_black);
+    number_score(&v, 0xFF, 3, is_black);
 
-    str_center(get_string(STR_ENTER), 6, score < 0);
-    str_center(get_string(STR_NAME), 8, score < 0);
+    str_center(get_string(STR_ENTER), 6, is_black);
+    str_center(get_string(STR_NAME), 8, is_black);
 
-    str_center(get_string(STR_START_OK), 16, score < 0);
+    str_center(get_string(STR_START_OK), 16, is_black);
 }
 
 void win_name_draw(uint16_t name, uint8_t is_black, uint8_t pos) BANKED {
@@ -283,35 +311,43 @@ void win_continue(void) BANKED {
     str_center(get_string(STR_B_NEW_GAME), 15, 1);
 }
 
-uint8_t win_game_draw(int32_t score, uint8_t initial) BANKED {
+uint8_t win_game_draw(const struct bcd *score, uint8_t initial) BANKED {
+    struct bcd v = *score;
     uint8_t is_black = 0;
-    if (score < 0) {
-        score = -score;
+    if (bcd_sign(&v) < 0) {
+        bcd_neg(&v);
         is_black = 1;
     }
 
     if (conf_get()->debug_flags & DBG_OUT_ON) {
         uint8_t redraw = 0;
 
-        static int32_t prev_score = 0;
-        if (initial || (score != prev_score)) {
-            prev_score = score;
+        // the debug output only moves when the number of digits changes
+        static uint8_t prev_x_off = 0;
+        uint8_t x_off = number_width(&v) >> 3;
+        if (initial || (x_off != prev_x_off)) {
+            prev_x_off = x_off;
             redraw = 1;
 
+            // queued digits must not land on top of the cleared line
+            vram_flush();
             fill_win(0, 0, 20, 2, 0xFF, BKGF_CGB_PAL3);
+            number_cached_reset(0, 0);
         }
+        number_cached(&v, is_black);
 
-        uint8_t x_off = number(score, 0, 0, is_black) >> 3;
         uint8_t y_off = 0;
 
         uint8_t y_max = (_cpu == CGB_TYPE) ? 2 : 1;
 
         if ((conf_get()->debug_flags & DBG_SHOW_FPS) && (y_off < 2)) {
             static uint8_t prev_fps = 0;
-            if ((game_fps != prev_fps) || redraw) {
+            static uint16_t prev_overruns = 0;
+            if ((game_fps != prev_fps) || (game_overruns != prev_overruns) || redraw) {
                 prev_fps = game_fps;
+                prev_overruns = game_overruns;
                 if (_cpu == CGB_TYPE) {
-                    sprintf(str_buff, get_string(STR_PRINTF_FPS), (uint8_t)game_fps);
+                    sprintf(str_buff, get_string(STR_PRINTF_FPS), (uint8_t)game_fps, (uint16_t)game_overruns);
                     str_ascii(str_buff, x_off, y_off, 1);
                 } else {
                     number(game_fps, x_off + 1, y_off, 1);
@@ -363,9 +399,29 @@ uint8_t win_game_draw(int32_t score, uint8_t initial) BANKED {
             y_off++;
         }
 
+        if ((conf_get()->debug_flags & DBG_SHOW_PROF) && (y_off < 2)) {
+            static uint8_t prev_load = 0;
+            uint8_t load = prof_load();
+            if ((load != prev_load) || redraw) {
+                prev_load = load;
+                if (_cpu == CGB_TYPE) {
+                    sprintf(str_buff, get_string(STR_PRINTF_PROF), (uint8_t)load);
+                    prof_bar(str_buff + strlen(str_buff), load);
+                    str_ascii(str_buff, x_off, y_off, 1);
+                } else {
+                    number(load, x_off + 1, y_off, 1);
+                }
+            }
+            y_off++;
+        }
+
         return DEVICE_SCREEN_PX_WIDTH;
     } else {
-        fill_win(0, 0, 10, 2, 0xFF, BKGF_CGB_PAL3);
-        return number(score, 0, 0, is_black);
+        if (initial) {
+            vram_flush();
+            fill_win(0, 0, 10, 2, 0xFF, BKGF_CGB_PAL3);
+            number_cached_reset(0, 0);
+        }
+        return number_cached(&v, is_black);
     }
 }
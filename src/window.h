@@ -26,7 +26,7 @@
 #include "score.h"
 #include "gbprinter.h"
 
-void win_splash_draw(int32_t lowest, int32_t highest) BANKED;
+void win_splash_draw(const struct bcd *lowest, const struct bcd *highest) BANKED;
 void win_splash_mp(void) BANKED;
 void win_score_clear(uint8_t is_black, uint8_t no_bg) BANKED;
 void win_score_draw(struct scores score, uint8_t off, uint8_t is_black) BANKED;
@@ -35,10 +35,10 @@ void win_about(void) BANKED;
 void win_about_mp(void) BANKED;
 void win_conf(void) BANKED;
 void win_debug(void) BANKED;
-void win_name(int32_t score) BANKED;
+void win_name(const struct bcd *score) BANKED;
 void win_name_draw(uint16_t name, uint8_t is_black, uint8_t pos) BANKED;
 void win_continue(void) BANKED;
-uint8_t win_game_draw(int32_t score, uint8_t initial) BANKED;
+uint8_t win_game_draw(const struct bcd *score, uint8_t initial) BANKED;
 
 void fill_win(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t tile, uint8_t attr) BANKED;
 
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+# Checks the linker map file for WRAM areas reaching into the
+# second shadow OAM page, which is placed with __at and so is
+# not known to the linker, see src/sprites.c.
+#
+#   util/check_ram.py -m build/duality.map -l 0xDC00
+
+import sys
+import re
+import argparse
+
+WRAM_START = 0xC000
+WRAM_END = 0xE000
+
+# _DATA    0000C0A0    00000F75 =    3957. bytes (REL,CON)
+AREA = re.compile(r"^(\S+)\s+([0-9A-Fa-f]{4,8})\s+([0-9A-Fa-f]{4,8})\s*=\s*\d+\.\s*bytes\s*\(([^)]*)\)")
+
+def main(args):
+    areas = 0
+    errors = 0
+
+    with open(args.map, "r") as f:
+        for line in f:
+            m = AREA.match(line.strip())
+            if not m:
+                continue
+            areas += 1
+
+            name = m.group(1)
+            start = int(m.group(2), 16)
+            size = int(m.group(3), 16)
+            attr = m.group(4)
+
+            # absolute areas are the __at variables themselves
+            if ("ABS" in attr) or (size == 0):
+                continue
+
+            if (start < WRAM_START) or (start >= WRAM_END):
+                continue
+
+            if args.verbose:
+                print(f"{name}: 0x{start:04X} - 0x{start + size - 1:04X}")
+
+            if (start + size) > args.limit:
+                print(f"{sys.argv[0]}: {name} ends at 0x{start + size - 1:04X}, above 0x{args.limit - 1:04X}")
+                errors += 1
+
+    if areas == 0:
+        print(f"{sys.argv[0]}: no areas found in {args.map}")
+        sys.exit(1)
+
+    if errors > 0:
+        sys.exit(1)
+
+if __name__=='__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-m", "--map", required=True)
+    parser.add_argument("-l", "--limit", type=lambda x: int(x, 0), required=True)
+    parser.add_argument("-v", "--verbose", action="store_true")
+    args = parser.parse_args()
+    main(args)
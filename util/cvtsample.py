@@ -26,6 +26,20 @@ BANKREF_EXTERN({:s})
 #endif
 """
 
+# the input is played back at 8192Hz, so stretch it for faster rates
+def resample(data, rate):
+    if rate == 8192:
+        return data
+
+    out = bytearray()
+    for i in range(len(data) * rate // 8192):
+        pos = i * 8192 / rate
+        n = int(pos)
+        a = data[n]
+        b = data[min(n + 1, len(data) - 1)]
+        out.append(round(a + (b - a) * (pos - n)))
+    return bytes(out)
+
 def main(argv=None):
     argv = argv or sys.argv
     if len(argv) < 2:
@@ -36,9 +50,10 @@ def main(argv=None):
     ident = argv[2] if len(argv) > 2 else None
     fmt = argv[3].upper() if len(argv) > 3 else "C"
     outdir = argv[4] if len(argv) > 4 else os.getcwd()
+    rate = int(argv[5]) if len(argv) > 5 else 8192
 
     if infilename in ('--help', '-h'):
-        print("usage: cvtsample.py SOURCE [IDENTIFIER] [FMT] [OUTDIR]")
+        print("usage: cvtsample.py SOURCE [IDENTIFIER] [FMT] [OUTDIR] [RATE]")
         return
 
     if ident == "(None)":
@@ -70,7 +85,7 @@ def main(argv=None):
     with wave.open(infilename, mode="rb") as f:
         p = f.getparams()        
         if (p.nchannels == 1) and (p.sampwidth == 1) and (p.framerate >= 8000) and (p.framerate <= 8192) and (p.comptype == 'NONE'):
-            data = f.readframes(p.nframes)
+            data = resample(f.readframes(p.nframes), rate)
             c = 0
             cnt = 0;
             flag = False
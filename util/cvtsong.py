@@ -0,0 +1,425 @@
+#!/usr/bin/env python3
+
+# Converts the text songs in data/*.song into the event
+# streams played by snd_play() in src/sound.c.
+#
+# Text format, '#' starts a comment:
+#
+#   tempo 150                  length of one step, in timer_get() units
+#   loop 0                     step to continue at after the end, or none
+#   instrument NAME pulse [duty=0..3] [length=0..0x3F] [env=0..0x0F]
+#   instrument NAME noise [length=0..0x3F] [env=0..0x0F] [poly=0..0xFF]
+#   pattern NAME ... end       tokens pasted wherever NAME is used
+#   channel 1|2 INSTRUMENT ... end
+#   channel 4 ... end
+#
+# Each token is one step. Notes are C0 to B5, with d for sharp and
+# b for flat (Cd1, Bb3). A '.' is a rest. On channel 4 the tokens are
+# instrument names instead of notes, on channels 1 and 2 '@NAME'
+# switches the instrument without using a step. Appending ':n' to
+# a token makes it last n steps. All channels need the same length.
+#
+# The steps of every channel are cut into patterns of the same
+# number of rows, picked to give the smallest output unless set with
+# 'rows n'. Identical patterns are stored once and each channel plays
+# an order list of pattern numbers. Patterns are streams of 4 bit
+# events, high nibble first:
+#
+#   0x0 .. 0xC  play entry n of the note table of the channel, one step
+#   0xD         rest for one step
+#   0xE n       wait n + 2 steps
+#   0xF n       n < 0xE: use instrument n for the following notes
+#   0xF 0xE n n play entry nn of the note table, one step
+#   0xF 0xF     end of the pattern
+#
+# The note table holds frequencies on the pulse channels and
+# instruments on the noise channel.
+
+import sys
+import os
+import re
+import argparse
+
+NIB_NOTES = 0xD
+NIB_REST = 0xD
+NIB_WAIT = 0xE
+NIB_EXT = 0xF
+EXT_NOTE = 0xE
+EXT_END = 0xF
+
+MAX_WAIT = 0x11
+MAX_INSTR = 0xE
+MAX_PATTERNS = 0xFF
+ORDER_END = 0xFF
+NO_LOOP = 0xFF
+ROWS = [ 4, 8, 16, 32, 64 ]
+
+CHANNELS = ["1", "2", "4"]
+NOISE = "4"
+
+# GB frequency register values for C0 to B5, same as the old src/sound.c
+FREQUENCIES = [
+      44,  156,  262,  363,  457,  547,  631,  710,  786,  854,  923,  986,
+    1046, 1102, 1155, 1205, 1253, 1297, 1339, 1379, 1417, 1452, 1486, 1517,
+    1546, 1575, 1602, 1627, 1650, 1673, 1694, 1714, 1732, 1750, 1767, 1783,
+    1798, 1812, 1825, 1837, 1849, 1860, 1871, 1881, 1890, 1899, 1907, 1915,
+    1923, 1930, 1936, 1943, 1949, 1954, 1959, 1964, 1969, 1974, 1978, 1982,
+    1985, 1988, 1992, 1995, 1998, 2001, 2004, 2006, 2009, 2011, 2013, 2015,
+]
+
+NOTES = { "C": 0, "D": 2, "E": 4, "F": 5, "G": 7, "A": 9, "B": 11 }
+
+sGBDK = """//AUTOGENERATED FILE FROM cvtsong
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+#include "{:s}.h"
+BANKREF({:s})
+"""
+
+hGBDK = """//AUTOGENERATED FILE FROM cvtsong
+#ifndef SONG_{:s}_H
+#define SONG_{:s}_H
+#include <stdint.h>
+#include <gbdk/platform.h>
+#include "sound.h"
+
+#define {:s}_SIZE {:d}
+extern const struct song {:s};
+
+BANKREF_EXTERN({:s})
+#endif
+"""
+
+class SongError(Exception):
+    pass
+
+def note_index(t):
+    m = re.fullmatch(r"([A-G])([db]?)([0-5])", t)
+    if not m:
+        return None
+    n = NOTES[m.group(1)] + int(m.group(3)) * 12
+    n += { "d": 1, "b": -1, "": 0 }[m.group(2)]
+    if (n < 0) or (n >= len(FREQUENCIES)):
+        return None
+    return n
+
+def parse(text):
+    song = {
+        "tempo": None,
+        "rows": None,
+        "loop": 0,
+        "instruments": {},
+        "patterns": {},
+        "channels": {},
+    }
+
+    block = None
+    for num, line in enumerate(text.split("\n"), 1):
+        words = line.split("#", 1)[0].split()
+        if len(words) == 0:
+            continue
+
+        try:
+            if block is not None:
+                if words == ["end"]:
+                    block = None
+                else:
+                    block.extend(words)
+            elif words[0] == "tempo":
+                song["tempo"] = int(words[1], 0)
+            elif words[0] == "rows":
+                song["rows"] = int(words[1], 0)
+            elif words[0] == "loop":
+                song["loop"] = None if words[1] == "none" else int(words[1], 0)
+            elif words[0] == "instrument":
+                if words[2] not in ("pulse", "noise"):
+                    raise SongError(f"unknown instrument type {words[2]}")
+                opts = dict(w.split("=", 1) for w in words[3:])
+                song["instruments"][words[1]] = {
+                    "type": words[2],
+                    "duty": int(opts.get("duty", "2"), 0),
+                    "length": int(opts["length"], 0) if "length" in opts else None,
+                    "env": int(opts.get("env", "0"), 0),
+                    "poly": int(opts.get("poly", "0"), 0),
+                }
+            elif words[0] == "pattern":
+                block = song["patterns"].setdefault(words[1], [])
+            elif words[0] == "channel":
+                if words[1] not in CHANNELS:
+                    raise SongError(f"no channel {words[1]}")
+                block = []
+                song["channels"][words[1]] = (words[2] if len(words) > 2 else None, block)
+            else:
+                raise SongError(f"unknown keyword {words[0]}")
+        except (IndexError, ValueError) as e:
+            raise SongError(f"line {num}: {e}")
+        except SongError as e:
+            raise SongError(f"line {num}: {e}")
+
+    if block is not None:
+        raise SongError("missing end")
+    if song["tempo"] is None:
+        raise SongError("missing tempo")
+    return song
+
+def expand(song, tokens, depth=0):
+    if depth > 16:
+        raise SongError("patterns nested too deep")
+
+    out = []
+    for t in tokens:
+        if t in song["patterns"]:
+            out.extend(expand(song, song["patterns"][t], depth + 1))
+        else:
+            out.append(t)
+    return out
+
+# one entry per step: ("note", n), ("drum", name) or None for a rest,
+# instrument switches as ("instr", name) without a step
+def steps(song, ch, tokens):
+    out = []
+    for t in tokens:
+        count = 1
+        if ":" in t:
+            t, n = t.split(":", 1)
+            count = int(n, 0)
+
+        if t.startswith("@") and (ch != NOISE):
+            out.append(("instr", t[1:]))
+            continue
+
+        if t == ".":
+            ev = None
+        elif ch == NOISE:
+            if t not in song["instruments"]:
+                raise SongError(f"channel {ch}: unknown drum {t}")
+            ev = ("drum", t)
+        else:
+            n = note_index(t)
+            if n is None:
+                raise SongError(f"channel {ch}: unknown note {t}")
+            ev = ("note", n)
+
+        out.append(ev)
+        out.extend([None] * (count - 1))
+    return out
+
+def encode(song, ch, seq, instr_index, note_index):
+    out = []
+    wait = 0
+
+    def flush():
+        nonlocal wait
+        while wait > 0:
+            n = min(wait, MAX_WAIT)
+            out.extend([NIB_REST] if n == 1 else [NIB_WAIT, n - 2])
+            wait -= n
+
+    for ev in seq:
+        if ev is None:
+            wait += 1
+            continue
+
+        flush()
+        if ev[0] == "instr":
+            out.extend([NIB_EXT, instr_index[ev[1]]])
+        else:
+            n = note_index[ev[1]]
+            out.extend([n] if n < NIB_NOTES else [NIB_EXT, EXT_NOTE, n >> 4, n & 0x0F])
+
+    flush()
+    out.extend([NIB_EXT, EXT_END])
+    if len(out) % 2:
+        out.append(0)
+    return tuple((out[i] << 4) | out[i + 1] for i in range(0, len(out), 2))
+
+# steps, instrument switches stay with the step after them
+def split(seq, rows):
+    chunks = [[]]
+    count = 0
+    for ev in seq:
+        if (count == rows) and ((ev is None) or (ev[0] != "instr")):
+            chunks.append([])
+            count = 0
+        chunks[-1].append(ev)
+        if (ev is None) or (ev[0] != "instr"):
+            count += 1
+    return chunks
+
+def instrument_at(seq, start):
+    instr = start
+    for ev in seq:
+        if (ev is not None) and (ev[0] == "instr"):
+            instr = ev[1]
+    return instr
+
+def arrange(song, seqs, starts, rows, instr_index, note_tables):
+    patterns = []
+    index = {}
+    orders = {}
+
+    for ch, seq in seqs.items():
+        order = []
+        instr = starts[ch]
+        for chunk in split(seq, rows):
+            # patterns are shared, so the pulse channels select their instrument first
+            if ch != NOISE:
+                chunk = [("instr", instr)] + chunk
+                instr = instrument_at(chunk, instr)
+
+            data = encode(song, ch, chunk, instr_index, note_tables[ch])
+            if data not in index:
+                index[data] = len(patterns)
+                patterns.append(data)
+            order.append(index[data])
+        orders[ch] = order
+
+    return patterns, orders
+
+def array(values, fmt="0x{:02X}"):
+    s = ""
+    for i in range(0, len(values), 16):
+        s += "\t" + ",".join(fmt.format(v) for v in values[i:i + 16]) + ",\n"
+    return s
+
+def convert(song, name):
+    seqs = {}
+    starts = {}
+    for ch, (start, tokens) in song["channels"].items():
+        if (start is not None) and (start not in song["instruments"]):
+            raise SongError(f"channel {ch}: unknown instrument {start}")
+        if (start is None) and (ch != NOISE):
+            raise SongError(f"channel {ch}: no instrument")
+        seqs[ch] = steps(song, ch, expand(song, tokens))
+        starts[ch] = start
+
+    lengths = set(sum(1 for ev in s if (ev is None) or (ev[0] != "instr")) for s in seqs.values())
+    if len(lengths) > 1:
+        raise SongError(f"channels differ in length: {sorted(lengths)}")
+    length = min(lengths)
+    if (song["loop"] is not None) and (song["loop"] >= length):
+        raise SongError(f"loop {song['loop']} is past the end")
+
+    names = list(song["instruments"].keys())
+    if len(names) > MAX_INSTR:
+        raise SongError("too many instruments")
+    instr_index = { n: i for i, n in enumerate(names) }
+
+    # most used first, so they fit into a single nibble
+    note_tables = {}
+    for ch, seq in seqs.items():
+        used = {}
+        for ev in seq:
+            if (ev is not None) and (ev[0] != "instr"):
+                used[ev[1]] = used.get(ev[1], 0) + 1
+        table = sorted(used, key=lambda n: (-used[n], str(n)))
+        if len(table) > 0x100:
+            raise SongError(f"channel {ch}: too many different notes")
+        note_tables[ch] = { n: i for i, n in enumerate(table) }
+
+    rows = ROWS if song["rows"] is None else [ song["rows"] ]
+    if song["loop"] is not None:
+        rows = [r for r in rows if song["loop"] % r == 0]
+        if len(rows) == 0:
+            raise SongError(f"loop {song['loop']} is not at the start of a pattern")
+
+    best = None
+    for r in rows:
+        patterns, orders = arrange(song, seqs, starts, r, instr_index, note_tables)
+        size = sum(len(p) + 2 for p in patterns) + sum(len(o) + 1 for o in orders.values())
+        if (best is None) or (size < best[0]):
+            best = (size, r, patterns, orders)
+    size, rows, patterns, orders = best
+
+    if len(patterns) > MAX_PATTERNS:
+        raise SongError("too many patterns")
+
+    # pulse notes fade out before the next step by default
+    default_length = 0x3F - min((song["tempo"] >> 2) + 1, 0x3F)
+
+    s = ""
+
+    s += f"static const struct snd_instr {name}_instr[] = {{\n"
+    for n in names:
+        i = song["instruments"][n]
+        reg = default_length if i["length"] is None else i["length"]
+        if i["type"] == "pulse":
+            reg |= (i["duty"] & 0x03) << 6
+        s += f"\t{{ .length = 0x{reg:02X}, .env = 0x{i['env'] & 0x0F:02X}, .poly = 0x{i['poly']:02X} }}, // {n}\n"
+    s += "};\n"
+    size += len(names) * 3
+
+    for i, p in enumerate(patterns):
+        s += f"static const uint8_t {name}_pat{i}[] = {{\n"
+        s += array(p)
+        s += "};\n"
+
+    s += f"static const uint8_t * const {name}_patterns[] = {{\n"
+    s += array(list(range(len(patterns))), f"{name}_pat{{:d}}")
+    s += "};\n"
+
+    orders_c = []
+    notes_c = []
+    loops = []
+    for ch in CHANNELS:
+        if ch not in seqs:
+            orders_c.append("NULL")
+            notes_c.append("NULL")
+            loops.append("SND_NO_LOOP")
+            continue
+
+        table = sorted(note_tables[ch], key=lambda n: note_tables[ch][n])
+        values = [instr_index[n] for n in table] if ch == NOISE else [FREQUENCIES[n] for n in table]
+        s += f"static const uint16_t {name}_notes{ch}[] = {{\n"
+        s += array(values or [0], "{:d}")
+        s += "};\n"
+        size += max(len(values), 1) * 2
+
+        s += f"static const uint8_t {name}_order{ch}[] = {{\n"
+        s += array(orders[ch] + [ORDER_END], "{:d}")
+        s += "};\n"
+
+        orders_c.append(f"{name}_order{ch}")
+        notes_c.append(f"{name}_notes{ch}")
+        loops.append("SND_NO_LOOP" if song["loop"] is None else str(song["loop"] // rows))
+
+    s += f"const struct song {name} = {{\n"
+    s += "\t.order = { " + ", ".join(orders_c) + " },\n"
+    s += "\t.notes = { " + ", ".join(notes_c) + " },\n"
+    s += f"\t.patterns = {name}_patterns,\n"
+    s += f"\t.instr = {name}_instr,\n"
+    s += f"\t.step = {song['tempo']},\n"
+    s += "\t.loop = { " + ", ".join(loops) + " },\n"
+    s += "};\n"
+
+    return s, size, length, len(patterns), rows
+
+def main(args):
+    name = os.path.splitext(os.path.basename(args.input))[0]
+
+    with open(args.input) as f:
+        text = f.read()
+
+    try:
+        s, size, length, count, rows = convert(parse(text), name)
+    except SongError as e:
+        print(f"{args.input}: {e}")
+        sys.exit(1)
+
+    if args.verbose:
+        print(f"Converted {name}: {length} steps in {size} bytes, {count} patterns of {rows} rows")
+
+    with open(os.path.join(args.dir, f"{name}.c"), "w") as f:
+        f.write(sGBDK.format(name, name))
+        f.write(s)
+    with open(os.path.join(args.dir, f"{name}.h"), "w") as f:
+        f.write(hGBDK.format(name.upper(), name.upper(), name, size, name, name))
+
+if __name__=='__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("input")
+    parser.add_argument("-d", "--dir", default=os.path.realpath("."))
+    parser.add_argument("-v", "--verbose", action="store_true")
+    args = parser.parse_args()
+    main(args)
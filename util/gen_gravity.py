@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+
+import sys
+import os
+import argparse
+
+hGBDK = """//AUTOGENERATED FILE FROM {:s}
+#ifndef GEN_CONST_GRAVITY_{:s}_H
+#define GEN_CONST_GRAVITY_{:s}_H
+#include <stdint.h>
+
+#define {:s}_SCALE {:d}
+#define {:s}_RANGE {:d}
+#define {:s}_QUANT {:d}
+#define {:s}_SIZE {:d}
+
+// static so it ends up in the bank of the one file including it
+static const {:s} {:s}[{:s}_SIZE] = {{
+{:s}}};
+#endif
+"""
+
+# pull towards an orb at offset off, as the shift arithmetic did it
+def force(off, r, shift):
+    if off > 0:
+        return (r - off) >> shift
+    elif off < 0:
+        return (-r - off) >> shift
+    return 0
+
+def calc(args):
+    s = ""
+
+    r = args.range << args.scale
+    length = ((2 * r) >> args.quant) + 1
+
+    for i in range(0, length):
+        first = (i << args.quant) - r
+        last = min(first + (1 << args.quant) - 1, r)
+
+        # most common value in this step of the offset
+        values = [force(off, r, args.shift) for off in range(first, last + 1)]
+        v = max(set(values), key=values.count)
+
+        s += f"    {v}, // {first} to {last}\n"
+
+    return (s, r, length)
+
+def main(args):
+    outheader = os.path.join(args.dir, f"{args.name}.h")
+
+    data, r, length = calc(args)
+
+    header = hGBDK.format(sys.argv[0],
+                          args.name, args.name,
+                          args.name, args.scale,
+                          args.name, r,
+                          args.name, args.quant,
+                          args.name, length,
+                          args.type, args.name, args.name,
+                          data)
+
+    if args.verbose:
+        print(f"Header: {outheader}")
+        print(header)
+
+    if not args.dry_run:
+        with open(outheader, "w") as o:
+            o.write(header)
+
+if __name__=='__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-d", "--dir", default=os.path.realpath("."))
+    parser.add_argument("-n", "--name", required=True) #default="gravity")
+    parser.add_argument("-r", "--range", default=24, type=int)
+    parser.add_argument("-p", "--scale", default=5, type=int)
+    parser.add_argument("-s", "--shift", default=9, type=int)
+    parser.add_argument("-q", "--quant", default=8, type=int)
+    parser.add_argument("-t", "--type", default="int8_t")
+    parser.add_argument("-v", "--verbose", action="store_true")
+    parser.add_argument("-y", "--dry-run", action="store_true")
+    args = parser.parse_args()
+    #print(args)
+    main(args)
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+
+# Compresses the tile data in the files written by png2asset,
+# in the format unpacked by src/lz.c.
+#
+# control byte 0b0nnnnnnn: n + 1 literal bytes follow
+# control byte 0b1nnnnnnn: copy n + MIN_MATCH bytes, starting
+#                          offset + 1 bytes back, offset follows
+
+import sys
+import os
+import re
+import argparse
+
+WINDOW = 256
+MIN_MATCH = 3
+MAX_MATCH = 0x7F + MIN_MATCH
+MAX_LITERAL = 0x80
+
+def compress(data):
+    out = []
+    lit = []
+
+    def flush():
+        while len(lit) > 0:
+            n = min(len(lit), MAX_LITERAL)
+            out.append(n - 1)
+            out.extend(lit[:n])
+            del lit[:n]
+
+    i = 0
+    while i < len(data):
+        best_len = 0
+        best_off = 0
+
+        # longest match in the window, may overlap the current position
+        for off in range(1, min(i, WINDOW) + 1):
+            n = 0
+            while (n < MAX_MATCH) and (i + n < len(data)) and (data[i + n - off] == data[i + n]):
+                n += 1
+            if n > best_len:
+                best_len = n
+                best_off = off
+
+        if best_len >= MIN_MATCH:
+            flush()
+            out.append(0x80 | (best_len - MIN_MATCH))
+            out.append(best_off - 1)
+            i += best_len
+        else:
+            lit.append(data[i])
+            i += 1
+
+    flush()
+    return out
+
+def decompress(data, length):
+    out = []
+    i = 0
+    while len(out) < length:
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            off = data[i] + 1
+            i += 1
+            for n in range((c & 0x7F) + MIN_MATCH):
+                out.append(out[-off])
+        else:
+            out.extend(data[i:i + c + 1])
+            i += c + 1
+    return out
+
+def array(values):
+    s = ""
+    for i in range(0, len(values), 16):
+        s += "\t" + ",".join(f"0x{v:02X}" for v in values[i:i + 16]) + ",\n"
+    return s
+
+def main(args):
+    source = os.path.join(args.dir, f"{args.name}.c")
+    header = os.path.join(args.dir, f"{args.name}.h")
+
+    with open(source) as f:
+        s = f.read()
+    with open(header) as f:
+        h = f.read()
+
+    name = f"{args.name}_tiles"
+    r = re.compile(r"(const\s+(?:uint8_t|unsigned\s+char)\s+" + name + r"\s*\[)(\d+)(\]\s*=\s*\{)(.*?)(\};)", re.S)
+    m = r.search(s)
+    if not m:
+        print(f"{sys.argv[0]}: no {name} in {source}")
+        sys.exit(1)
+
+    raw = [int(v, 0) for v in m.group(4).replace("\n", " ").split(",") if v.strip()]
+    packed = compress(raw)
+
+    if decompress(packed, len(raw)) != raw:
+        print(f"{sys.argv[0]}: {name} does not unpack again")
+        sys.exit(1)
+
+    s = s[:m.start()] + m.group(1) + str(len(packed)) + m.group(3) + "\n" + array(packed) + m.group(5) + s[m.end():]
+    h = re.sub(r"(" + name + r"\s*\[)\d+(\])", r"\g<1>" + str(len(packed)) + r"\2", h)
+    h = h.replace("extern const", f"#define {args.name}_TILES_RAW_SIZE {len(raw)}\nextern const", 1)
+
+    if args.verbose:
+        print(f"Compressed {name}: {len(raw)} -> {len(packed)} bytes, saved {len(raw) - len(packed)}")
+
+    if not args.dry_run:
+        with open(source, "w") as f:
+            f.write(s)
+        with open(header, "w") as f:
+            f.write(h)
+
+if __name__=='__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-d", "--dir", default=os.path.realpath("."))
+    parser.add_argument("-n", "--name", required=True)
+    parser.add_argument("-v", "--verbose", action="store_true")
+    parser.add_argument("-y", "--dry-run", action="store_true")
+    args = parser.parse_args()
+    main(args)
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+
+# Converts a joypad recording from the battery save file
+# into a replay for the host simulation, see src/record.h.
+#
+#   util/rec2sim.py -i build/duality.sav -o my_replay.txt
+#   make SIM_REPLAY=my_replay.txt sim_run
+
+import sys
+import argparse
+
+BANK_SIZE = 0x2000
+REC_MAGIC = 0xD6
+REC_HEADER = 6 # magic, seed, len, tier
+REC_COUNT_MASK = 0x3F
+REC_STEPS_SHIFT = 6
+
+KEYS = [
+    (0x01, "right"),
+    (0x02, "left"),
+    (0x04, "up"),
+    (0x08, "down"),
+    (0x10, "a"),
+    (0x20, "b"),
+    (0x40, "select"),
+    (0x80, "start"),
+]
+
+def key_names(keys):
+    names = [n for k, n in KEYS if keys & k]
+    if len(names) == 0:
+        return "none"
+    return "+".join(names)
+
+def main(args):
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    # struct rec_mem is the only variable in SRAM bank 1
+    d = data[args.bank * BANK_SIZE:(args.bank + 1) * BANK_SIZE]
+    if (len(d) < REC_HEADER) or (d[0] != REC_MAGIC):
+        print(f"{sys.argv[0]}: no complete recording in {args.input}")
+        sys.exit(1)
+
+    seed = d[1] | (d[2] << 8)
+    length = d[3] | (d[4] << 8)
+    tier = d[5]
+    if (REC_HEADER + (length * 2)) > len(d):
+        print(f"{sys.argv[0]}: invalid length {length} in {args.input}")
+        sys.exit(1)
+
+    frames = 0
+    s = "# Duality recording, converted from " + args.input + "\n\n"
+    s += f"seed 0x{seed:04X}\n"
+    s += f"tier {tier}\n\n"
+    for i in range(length):
+        run = REC_HEADER + (i * 2)
+        count = d[run] & REC_COUNT_MASK
+        steps = (d[run] >> REC_STEPS_SHIFT) + 1
+        keys = d[run + 1]
+        s += f"{count} {key_names(keys)} {steps}\n"
+        frames += count
+
+    if args.verbose:
+        print(f"Converted {length} runs, {frames} frames, seed 0x{seed:04X}, tier {tier}")
+
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(s)
+    else:
+        print(s, end="")
+
+if __name__=='__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument("-i", "--input", required=True)
+    parser.add_argument("-o", "--output")
+    parser.add_argument("-b", "--bank", type=int, default=1)
+    parser.add_argument("-v", "--verbose", action="store_true")
+    args = parser.parse_args()
+    main(args)